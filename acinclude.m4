@@ -7,12 +7,33 @@ AC_DEFUN([AX_LIBESEDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libesedb/libesedb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Headers and functions included in libesedb/libesedb_memory_map.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([close fstat mmap munmap open])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
   dnl Check if library should be build with debug output
   AX_COMMON_CHECK_ENABLE_DEBUG_OUTPUT
 
+  dnl Check if library should fall back to the libfwnt LZXPRESS decompression
+  AX_COMMON_ARG_ENABLE(
+    [lzxpress-fallback],
+    [lzxpress_fallback],
+    [fall back to libfwnt when LZXPRESS decompression fails],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_lzxpress_fallback" != xno],
+    [AC_DEFINE(
+      [HAVE_LZXPRESS_FALLBACK],
+      [1],
+      [Define to 1 if LZXPRESS decompression should fall back to libfwnt.])
+
+    ac_cv_enable_lzxpress_fallback=yes])
+
   dnl Check if DLL support is needed
   AS_IF(
     [test "x$enable_shared" = xyes],
@@ -47,6 +47,8 @@
 
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
+#define EXPORT_HANDLE_LONG_VALUE_DATA_BUFFER_SIZE	65536
+
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -1121,20 +1123,20 @@ int export_handle_export_table(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t *item_filename = NULL;
-	system_character_t *value_string  = NULL;
-	libesedb_column_t *column         = NULL;
-	libesedb_record_t *record         = NULL;
-	FILE *table_file_stream           = NULL;
-	static char *function             = "export_handle_export_table";
-	size_t item_filename_size         = 0;
-	size_t value_string_size          = 0;
-	int column_iterator               = 0;
-	int known_table                   = 0;
-	int number_of_columns             = 0;
-	int number_of_records             = 0;
-	int record_iterator               = 0;
-	int result                        = 0;
+	system_character_t *item_filename       = NULL;
+	system_character_t *value_string        = NULL;
+	libesedb_column_t *column               = NULL;
+	libesedb_record_t *record               = NULL;
+	libesedb_record_cursor_t *record_cursor = NULL;
+	FILE *table_file_stream                 = NULL;
+	static char *function                   = "export_handle_export_table";
+	size_t item_filename_size               = 0;
+	size_t value_string_size                = 0;
+	int column_iterator                     = 0;
+	int known_table                         = 0;
+	int number_of_columns                   = 0;
+	int record_iterator                     = 0;
+	int result                              = 0;
 
 	if( table == NULL )
 	{
@@ -1359,30 +1361,30 @@ int export_handle_export_table(
 		}
 	}
 	/* Write the record (row) values to the table file
+	 * The records are read in sequence using a record cursor
 	 */
-	if( libesedb_table_get_number_of_records(
+	if( libesedb_table_get_record_cursor(
 	     table,
-	     &number_of_records,
+	     &record_cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 "%s: unable to retrieve record cursor.",
 		 function );
 
 		goto on_error;
 	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
+	do
 	{
-		if( libesedb_table_get_record(
-		     table,
-		     record_iterator,
-		     &record,
-		     error ) != 1 )
+		result = libesedb_record_cursor_get_next_record(
+		          record_cursor,
+		          &record,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1394,6 +1396,10 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
 /* TODO move to separate export table functions */
 		known_table = 0;
 
@@ -1639,11 +1645,28 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
+		record_iterator++;
+
 		if( export_handle->abort != 0 )
 		{
 			break;
 		}
 	}
+	while( result == 1 );
+
+	if( libesedb_record_cursor_free(
+	     &record_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record cursor.",
+		 function );
+
+		goto on_error;
+	}
 	if( file_stream_close(
 	     table_file_stream ) != 0 )
 	{
@@ -1692,6 +1715,12 @@ on_error:
 		 &record,
 		 NULL );
 	}
+	if( record_cursor != NULL )
+	{
+		libesedb_record_cursor_free(
+		 &record_cursor,
+		 NULL );
+	}
 	if( value_string != NULL )
 	{
 		memory_free(
@@ -3114,7 +3143,7 @@ int export_handle_export_basic_record_value(
 
 	system_character_t *value_string  = NULL;
 	libfdatetime_filetime_t *filetime = NULL;
-	uint8_t *value_data               = NULL;
+	const uint8_t *value_data         = NULL;
 	static char *function             = "export_handle_export_basic_record_value";
 	size_t value_data_size            = 0;
 	size_t value_string_size          = 0;
@@ -3644,9 +3673,12 @@ int export_handle_export_basic_record_value(
 			break;
 
 		default:
-			if( libesedb_record_get_value_data_size(
+			/* The value data is exported directly from the record without copying
+			 */
+			if( libesedb_record_get_value_data_reference(
 			     record,
 			     record_value_entry,
+			     &value_data,
 			     &value_data_size,
 			     error ) != 1 )
 			{
@@ -3654,55 +3686,17 @@ int export_handle_export_basic_record_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value: %d data size.",
+				 "%s: unable to retrieve value: %d data.",
 				 function,
 				 record_value_entry );
 
 				goto on_error;
 			}
-			if( value_data_size > 0 )
-			{
-				value_data = (uint8_t *) memory_allocate(
-				                          sizeof( uint8_t ) * value_data_size );
-
-				if( value_data == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value data.",
-					 function );
-
-					goto on_error;
-				}
-				if( libesedb_record_get_value_data(
-				     record,
-				     record_value_entry,
-				     value_data,
-				     value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value: %d data.",
-					 function,
-					 record_value_entry );
-
-					goto on_error;
-				}
-				export_binary_data(
-				 value_data,
-				 value_data_size,
-				 record_file_stream );
+			export_binary_data(
+			 value_data,
+			 value_data_size,
+			 record_file_stream );
 
-				memory_free(
-				 value_data );
-
-				value_data = NULL;
-			}
 			break;
 	}
 	return( 1 );
@@ -3719,11 +3713,6 @@ on_error:
 		 &filetime,
 		 NULL );
 	}
-	if( value_data != NULL )
-	{
-		memory_free(
-		 value_data );
-	}
 	return( -1 );
 }
 
@@ -3743,6 +3732,7 @@ int export_handle_export_long_record_value(
 	static char *function             = "export_handle_export_long_record_value";
 	size64_t value_data_size          = 0;
 	size_t value_string_size          = 0;
+	ssize_t read_count                = 0;
 	uint32_t column_identifier        = 0;
 	uint32_t column_type              = 0;
 	uint8_t value_data_flags          = 0;
@@ -4006,22 +3996,12 @@ int export_handle_export_long_record_value(
 
 				goto on_error;
 			}
-			if( value_data_size > (size64_t) SSIZE_MAX )
-			{	
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid value: %d data size value out of bounds.",
-				 function,
-				 record_value_entry );
-
-				goto on_error;
-			}
+			/* The data is exported in chunks to keep memory usage bounded for large values
+			 */
 			if( value_data_size > 0 )
 			{
 				value_data = (uint8_t *) memory_allocate(
-				                          sizeof( uint8_t ) * value_data_size );
+				                          sizeof( uint8_t ) * EXPORT_HANDLE_LONG_VALUE_DATA_BUFFER_SIZE );
 
 				if( value_data == NULL )
 				{
@@ -4034,26 +4014,32 @@ int export_handle_export_long_record_value(
 
 					goto on_error;
 				}
-				if( libesedb_long_value_get_data(
-				     long_value,
-				     value_data,
-				     (size_t) value_data_size,
-				     error ) != 1 )
+				do
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value: %d data.",
-					 function,
-					 record_value_entry );
+					read_count = libesedb_long_value_read_buffer(
+					              long_value,
+					              value_data,
+					              EXPORT_HANDLE_LONG_VALUE_DATA_BUFFER_SIZE,
+					              error );
 
-					goto on_error;
+					if( read_count == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve value: %d data.",
+						 function,
+						 record_value_entry );
+
+						goto on_error;
+					}
+					export_binary_data(
+					 value_data,
+					 (size_t) read_count,
+					 record_file_stream );
 				}
-				export_binary_data(
-				 value_data,
-				 value_data_size,
-				 record_file_stream );
+				while( read_count > 0 );
 
 				memory_free(
 				 value_data );
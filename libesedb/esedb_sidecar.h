@@ -0,0 +1,136 @@
+/*
+ * The sidecar cache file definition of an Extensible Storage Engine (ESE) Database File (EDB)
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_SIDECAR_H )
+#define _ESEDB_SIDECAR_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_sidecar_header esedb_sidecar_header_t;
+
+struct esedb_sidecar_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "ESEDBSC\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The page size of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The size of the database file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The (stored) checksum of the database file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The number of sections
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sections[ 4 ];
+
+	/* The database time of the database file header
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The size of the sections data
+	 * Consists of 4 bytes
+	 */
+	uint8_t sections_data_size[ 4 ];
+
+	/* The checksum of the sections data
+	 * A XOR-32 checksum calculated over the sections data
+	 * with an initial value of 0x89abcdef
+	 * Consists of 4 bytes
+	 */
+	uint8_t sections_data_checksum[ 4 ];
+};
+
+typedef struct esedb_sidecar_section_header esedb_sidecar_section_header_t;
+
+struct esedb_sidecar_section_header
+{
+	/* The section type
+	 * Consists of 4 bytes
+	 */
+	uint8_t section_type[ 4 ];
+
+	/* The root page number of the page tree the section describes
+	 * Consists of 4 bytes
+	 */
+	uint8_t root_page_number[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The size of the entries data
+	 * Every entry consists of a 32-bit size followed by the entry data
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+typedef struct esedb_sidecar_leaf_page_descriptor esedb_sidecar_leaf_page_descriptor_t;
+
+struct esedb_sidecar_leaf_page_descriptor
+{
+	/* The page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_number[ 4 ];
+
+	/* The first leaf value index
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_leaf_value_index[ 4 ];
+
+	/* The last leaf value index
+	 * Consists of 4 bytes
+	 */
+	uint8_t last_leaf_value_index[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_SIDECAR_H ) */
+
@@ -36,6 +36,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_sidecar.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a catalog
@@ -196,6 +197,19 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
+		if( libesedb_catalog_free_name_hash_table(
+		     *catalog,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name hash table.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *catalog )->table_definition_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_table_definition_free,
@@ -495,12 +509,14 @@ on_error:
 }
 
 /* Reads the catalog values from a leaf page
+ * If a sidecar is provided the catalog values are also appended to its last section
  * Returns 1 if successful or -1 on error
  */
 int libesedb_catalog_read_values_from_leaf_page(
      libesedb_catalog_t *catalog,
      libesedb_page_t *page,
      libesedb_table_definition_t **table_definition,
+     libesedb_sidecar_t *sidecar,
      libcerror_error_t **error )
 {
 	libesedb_page_tree_value_t *page_tree_value = NULL;
@@ -656,6 +672,24 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 			goto on_error;
 		}
+		if( sidecar != NULL )
+		{
+			if( libesedb_sidecar_append_entry(
+			     sidecar,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append catalog value to sidecar.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
 		     error ) != 1 )
@@ -682,7 +716,82 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the catalog values from the entries data of a sidecar section
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_values_from_sidecar(
+     libesedb_catalog_t *catalog,
+     const uint8_t *entries_data,
+     size_t entries_data_size,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data  = NULL;
+	static char *function      = "libesedb_catalog_read_values_from_sidecar";
+	size_t entries_data_offset = 0;
+	size_t entry_data_size     = 0;
+	int result                 = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libesedb_sidecar_get_next_entry(
+		          entries_data,
+		          entries_data_size,
+		          &entries_data_offset,
+		          &entry_data,
+		          &entry_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sidecar entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     entry_data,
+			     entry_data_size,
+			     table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+}
+
 /* Reads the catalog
+ * If the IO handle has a sidecar that contains the catalog values, the catalog
+ * is read from the sidecar otherwise the catalog values are recorded in it
  * Returns 1 if successful or -1 on error
  */
 int libesedb_catalog_read_file_io_handle(
@@ -691,9 +800,14 @@ int libesedb_catalog_read_file_io_handle(
      libcerror_error_t **error )
 {
 	libesedb_page_t *page                         = NULL;
+	libesedb_sidecar_t *sidecar                   = NULL;
 	libesedb_table_definition_t *table_definition = NULL;
+	const uint8_t *entries_data                   = NULL;
 	static char *function                         = "libesedb_catalog_read_file_io_handle";
+	size_t entries_data_size                      = 0;
 	uint32_t leaf_page_number                     = 0;
+	uint32_t number_of_entries                    = 0;
+	int result                                    = 0;
 
 	if( catalog == NULL )
 	{
@@ -717,30 +831,97 @@ int libesedb_catalog_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( libesedb_page_tree_get_get_first_leaf_page_number(
-	     catalog->page_tree,
-	     file_io_handle,
-	     &leaf_page_number,
-	     error ) != 1 )
+	if( catalog->page_tree->io_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first leaf page number from page tree.",
-		 function );
+		sidecar = catalog->page_tree->io_handle->sidecar;
+	}
+	if( sidecar != NULL )
+	{
+		result = libesedb_sidecar_get_section(
+		          sidecar,
+		          LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+		          catalog->page_tree->root_page_number,
+		          &entries_data,
+		          &entries_data_size,
+		          &number_of_entries,
+		          error );
 
-		return( -1 );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog values section from sidecar.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_catalog_read_values_from_sidecar(
+			     catalog,
+			     entries_data,
+			     entries_data_size,
+			     &table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read values from sidecar.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libesedb_sidecar_append_section(
+			     sidecar,
+			     LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+			     catalog->page_tree->root_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append catalog values section to sidecar.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( result == 0 )
+	{
+		if( libesedb_page_tree_get_get_first_leaf_page_number(
+		     catalog->page_tree,
+		     file_io_handle,
+		     &leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number from page tree.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	while( leaf_page_number != 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
+		if( libesedb_page_get_from_pages_vector(
 		     catalog->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) catalog->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		     file_io_handle,
+		     catalog->page_tree->pages_cache,
+		     catalog->page_tree->io_handle,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -757,6 +938,7 @@ int libesedb_catalog_read_file_io_handle(
 		     catalog,
 		     page,
 		     &table_definition,
+		     sidecar,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -785,103 +967,180 @@ int libesedb_catalog_read_file_io_handle(
 			return( -1 );
 		}
 	}
+	if( libesedb_catalog_build_name_hash_table(
+	     catalog,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name hash table.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the number of table definitions
+/* Determines the name hash of a narrow character (byte stream) name
+ * The hash only covers the characters up to the first end-of-string character.
+ * Names that contain non-ASCII characters are all given the name hash 0, since
+ * their encoding depends on the codepage
  * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_number_of_table_definitions(
-     libesedb_catalog_t *catalog,
-     int *number_of_table_definitions,
+int libesedb_catalog_get_name_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *name_hash,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_get_number_of_table_definitions";
+	static char *function = "libesedb_catalog_get_name_hash";
+	size_t name_index     = 0;
+	uint32_t safe_hash    = 0x811c9dc5UL;
 
-	if( catalog == NULL )
+	if( name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid catalog.",
+		 "%s: invalid name.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     number_of_table_definitions,
-	     error ) != 1 )
+	if( name_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from table definition array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
 		 function );
 
 		return( -1 );
 	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		if( name[ name_index ] == 0 )
+		{
+			break;
+		}
+		if( name[ name_index ] >= 0x80 )
+		{
+			*name_hash = 0;
+
+			return( 1 );
+		}
+		/* The 32-bit FNV-1a hash
+		 */
+		safe_hash ^= name[ name_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	if( safe_hash == 0 )
+	{
+		safe_hash = 1;
+	}
+	*name_hash = safe_hash;
+
 	return( 1 );
 }
 
-/* Retrieves the table definition for the specific index
+/* Determines the name hash of an UTF-16 encoded name
+ * The resulting hash is identical to that of the corresponding narrow character name
  * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_table_definition_by_index(
-     libesedb_catalog_t *catalog,
-     int table_definition_index,
-     libesedb_table_definition_t **table_definition,
+int libesedb_catalog_get_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_get_table_definition_by_index";
+	static char *function = "libesedb_catalog_get_utf16_name_hash";
+	size_t string_index   = 0;
+	uint32_t safe_hash    = 0x811c9dc5UL;
 
-	if( catalog == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid catalog.",
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     catalog->table_definition_array,
-	     table_definition_index,
-	     (intptr_t **) table_definition,
-	     error ) != 1 )
+	if( utf16_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from table definition array.",
-		 function,
-		 table_definition_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
 
 		return( -1 );
 	}
+	for( string_index = 0;
+	     string_index < utf16_string_length;
+	     string_index++ )
+	{
+		if( utf16_string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( utf16_string[ string_index ] >= 0x80 )
+		{
+			*name_hash = 0;
+
+			return( 1 );
+		}
+		safe_hash ^= (uint8_t) utf16_string[ string_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	if( safe_hash == 0 )
+	{
+		safe_hash = 1;
+	}
+	*name_hash = safe_hash;
+
 	return( 1 );
 }
 
-/* Retrieves the table definition for the specific name
- * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
+/* Frees the name hash table
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_catalog_get_table_definition_by_name(
+int libesedb_catalog_free_name_hash_table(
      libesedb_catalog_t *catalog,
-     const uint8_t *table_name,
-     size_t table_name_size,
-     libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
-	libesedb_table_definition_t *safe_table_definition = NULL;
-	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
-	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
-	int result                                         = 0;
+	static char *function = "libesedb_catalog_free_name_hash_table";
 
 	if( catalog == NULL )
 	{
@@ -894,59 +1153,571 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
-	if( table_name == NULL )
+	if( catalog->name_hash_buckets != NULL )
+	{
+		memory_free(
+		 catalog->name_hash_buckets );
+
+		catalog->name_hash_buckets = NULL;
+	}
+	if( catalog->name_hash_entries != NULL )
+	{
+		memory_free(
+		 catalog->name_hash_entries );
+
+		catalog->name_hash_entries = NULL;
+	}
+	catalog->number_of_name_hash_buckets = 0;
+	catalog->number_of_name_hash_entries = 0;
+
+	return( 1 );
+}
+
+/* Builds the name hash table from the table definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_build_name_hash_table(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error )
+{
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_catalog_build_name_hash_table";
+	uint32_t name_hash                            = 0;
+	int bucket_index                              = 0;
+	int entry_index                               = 0;
+	int number_of_buckets                         = 0;
+	int number_of_entries                         = 0;
+
+	if( catalog == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
+		 "%s: invalid catalog.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( table_name_size == 0 )
-	 || ( table_name_size > (size_t) SSIZE_MAX ) )
+	if( libesedb_catalog_free_name_hash_table(
+	     catalog,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid table name size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free name hash table.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition == NULL )
-	{
-		libcerror_error_set(
-		 error,
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( number_of_entries > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of table definitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a power of 2 number of buckets that keeps the load factor below 0.5
+	 */
+	number_of_buckets = 16;
+
+	while( number_of_buckets < ( number_of_entries * 2 ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	catalog->name_hash_buckets = (int *) memory_allocate(
+	                                      sizeof( int ) * number_of_buckets );
+
+	if( catalog->name_hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	catalog->name_hash_entries = (libesedb_catalog_name_hash_entry_t *) memory_allocate(
+	                                                                     sizeof( libesedb_catalog_name_hash_entry_t ) * number_of_entries );
+
+	if( catalog->name_hash_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		catalog->name_hash_buckets[ bucket_index ] = -1;
+	}
+	/* The table definitions are inserted in reverse order so that each bucket
+	 * lists its table definitions in the same order as the table definition array
+	 */
+	for( entry_index = number_of_entries - 1;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		catalog->name_hash_entries[ entry_index ].name_hash        = 0;
+		catalog->name_hash_entries[ entry_index ].next_entry_index = -1;
+
+		if( libcdata_array_get_entry_by_index(
+		     catalog->table_definition_array,
+		     entry_index,
+		     (intptr_t **) &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from table definition array.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* A table definition without a name cannot be looked up by name
+		 */
+		if( ( table_definition->table_catalog_definition == NULL )
+		 || ( table_definition->table_catalog_definition->name == NULL ) )
+		{
+			continue;
+		}
+		if( libesedb_catalog_get_name_hash(
+		     table_definition->table_catalog_definition->name,
+		     table_definition->table_catalog_definition->name_size,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine name hash of table definition: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		bucket_index = (int) ( name_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+		catalog->name_hash_entries[ entry_index ].name_hash        = name_hash;
+		catalog->name_hash_entries[ entry_index ].next_entry_index = catalog->name_hash_buckets[ bucket_index ];
+
+		catalog->name_hash_buckets[ bucket_index ] = entry_index;
+	}
+	catalog->number_of_name_hash_buckets = number_of_buckets;
+	catalog->number_of_name_hash_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	libesedb_catalog_free_name_hash_table(
+	 catalog,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the index of the first table definition that has a specific name hash
+ * If the name hash table has not been built every table definition is considered a candidate
+ * Returns 1 if successful, 0 if no such table definition or -1 on error
+ */
+int libesedb_catalog_get_first_name_hash_entry_index(
+     libesedb_catalog_t *catalog,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_first_name_hash_entry_index";
+	int number_of_entries = 0;
+	int safe_entry_index  = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table definition.",
+		 "%s: invalid catalog.",
 		 function );
 
 		return( -1 );
 	}
-	*table_definition = NULL;
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->name_hash_buckets == NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     catalog->table_definition_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries in table definition array.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_entries <= 0 )
+		{
+			return( 0 );
+		}
+		*entry_index = 0;
+
+		return( 1 );
+	}
+	safe_entry_index = catalog->name_hash_buckets[ name_hash & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) ];
+
+	while( safe_entry_index != -1 )
+	{
+		if( ( safe_entry_index < 0 )
+		 || ( safe_entry_index >= catalog->number_of_name_hash_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( catalog->name_hash_entries[ safe_entry_index ].name_hash == name_hash )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = catalog->name_hash_entries[ safe_entry_index ].next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the next table definition that has a specific name hash
+ * The entry index contains the index of the previous table definition on input
+ * Returns 1 if successful, 0 if no such table definition or -1 on error
+ */
+int libesedb_catalog_get_next_name_hash_entry_index(
+     libesedb_catalog_t *catalog,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_next_name_hash_entry_index";
+	int number_of_entries = 0;
+	int safe_entry_index  = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_index = *entry_index;
+
+	if( catalog->name_hash_buckets == NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     catalog->table_definition_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries in table definition array.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( safe_entry_index < 0 )
+		 || ( safe_entry_index >= ( number_of_entries - 1 ) ) )
+		{
+			return( 0 );
+		}
+		*entry_index = safe_entry_index + 1;
+
+		return( 1 );
+	}
+	if( ( safe_entry_index < 0 )
+	 || ( safe_entry_index >= catalog->number_of_name_hash_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_index = catalog->name_hash_entries[ safe_entry_index ].next_entry_index;
+
+	while( safe_entry_index != -1 )
+	{
+		if( ( safe_entry_index < 0 )
+		 || ( safe_entry_index >= catalog->number_of_name_hash_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( catalog->name_hash_entries[ safe_entry_index ].name_hash == name_hash )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = catalog->name_hash_entries[ safe_entry_index ].next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of table definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_number_of_table_definitions(
+     libesedb_catalog_t *catalog,
+     int *number_of_table_definitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_number_of_table_definitions";
 
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     catalog->table_definition_array,
-	     &number_of_entries,
+	     number_of_table_definitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to retrieve number of entries from table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_index(
+     libesedb_catalog_t *catalog,
+     int table_definition_index,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_table_definition_by_index";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     catalog->table_definition_array,
+	     table_definition_index,
+	     (intptr_t **) table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from table definition array.",
+		 function,
+		 table_definition_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific name
+ * Returns 1 if successful, 0 if no corresponding table definition was found or -1 on error
+ */
+int libesedb_catalog_get_table_definition_by_name(
+     libesedb_catalog_t *catalog,
+     const uint8_t *table_name,
+     size_t table_name_size,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_table_definition_t *safe_table_definition = NULL;
+	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
+	uint32_t name_hash                                 = 0;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_name_size == 0 )
+	 || ( table_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid table name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	*table_definition = NULL;
+
+	if( libesedb_catalog_get_name_hash(
+	     table_name,
+	     table_name_size,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	result = libesedb_catalog_get_first_name_hash_entry_index(
+	          catalog,
+	          name_hash,
+	          &entry_index,
+	          error );
+
+	while( result == 1 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
@@ -996,14 +1767,28 @@ int libesedb_catalog_get_table_definition_by_name(
 		}
 		else if( result == 1 )
 		{
-			break;
+			*table_definition = safe_table_definition;
+
+			return( 1 );
 		}
+		result = libesedb_catalog_get_next_name_hash_entry_index(
+		          catalog,
+		          name_hash,
+		          &entry_index,
+		          error );
 	}
-	if( result != 0 )
+	if( result == -1 )
 	{
-		*table_definition = safe_table_definition;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition index for name hash.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	return( 0 );
 }
 
 /* Retrieves the table definition for the specific UTF-8 encoded name
@@ -1018,8 +1803,8 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf8_name";
+	uint32_t name_hash                                 = 0;
 	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1069,23 +1854,28 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
+	if( libesedb_catalog_get_name_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to determine name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	result = libesedb_catalog_get_first_name_hash_entry_index(
+	          catalog,
+	          name_hash,
+	          &entry_index,
+	          error );
+
+	while( result == 1 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
@@ -1135,16 +1925,28 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 		}
 		else if( result == LIBUNA_COMPARE_EQUAL )
 		{
-			result = 1;
+			*table_definition = safe_table_definition;
 
-			break;
+			return( 1 );
 		}
+		result = libesedb_catalog_get_next_name_hash_entry_index(
+		          catalog,
+		          name_hash,
+		          &entry_index,
+		          error );
 	}
-	if( result != 0 )
+	if( result == -1 )
 	{
-		*table_definition = safe_table_definition;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition index for name hash.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	return( 0 );
 }
 
 /* Retrieves the table definition for the specific UTF-16 encoded name
@@ -1159,8 +1961,8 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf16_name";
+	uint32_t name_hash                                 = 0;
 	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1210,23 +2012,28 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
+	if( libesedb_catalog_get_utf16_name_hash(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to determine name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	result = libesedb_catalog_get_first_name_hash_entry_index(
+	          catalog,
+	          name_hash,
+	          &entry_index,
+	          error );
+
+	while( result == 1 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     catalog->table_definition_array,
@@ -1276,15 +2083,27 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 		}
 		else if( result == LIBUNA_COMPARE_EQUAL )
 		{
-			result = 1;
+			*table_definition = safe_table_definition;
 
-			break;
+			return( 1 );
 		}
+		result = libesedb_catalog_get_next_name_hash_entry_index(
+		          catalog,
+		          name_hash,
+		          &entry_index,
+		          error );
 	}
-	if( result != 0 )
+	if( result == -1 )
 	{
-		*table_definition = safe_table_definition;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition index for name hash.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	return( 0 );
 }
 
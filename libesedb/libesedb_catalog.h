@@ -32,12 +32,26 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_sidecar.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libesedb_catalog_name_hash_entry libesedb_catalog_name_hash_entry_t;
+
+struct libesedb_catalog_name_hash_entry
+{
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The index of the next table definition in the same bucket or -1
+	 */
+	int next_entry_index;
+};
+
 typedef struct libesedb_catalog libesedb_catalog_t;
 
 struct libesedb_catalog
@@ -49,6 +63,22 @@ struct libesedb_catalog
 	/* The table definition array
 	 */
 	libcdata_array_t *table_definition_array;
+
+	/* The name hash buckets, contains the index of the first table definition per bucket or -1
+	 */
+	int *name_hash_buckets;
+
+	/* The number of name hash buckets
+	 */
+	int number_of_name_hash_buckets;
+
+	/* The name hash entries, one per table definition
+	 */
+	libesedb_catalog_name_hash_entry_t *name_hash_entries;
+
+	/* The number of name hash entries
+	 */
+	int number_of_name_hash_entries;
 };
 
 int libesedb_catalog_initialize(
@@ -74,6 +104,14 @@ int libesedb_catalog_read_values_from_leaf_page(
      libesedb_catalog_t *catalog,
      libesedb_page_t *page,
      libesedb_table_definition_t **table_definition,
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_values_from_sidecar(
+     libesedb_catalog_t *catalog,
+     const uint8_t *entries_data,
+     size_t entries_data_size,
+     libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
 int libesedb_catalog_read_file_io_handle(
@@ -81,6 +119,38 @@ int libesedb_catalog_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_catalog_get_name_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libesedb_catalog_get_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libesedb_catalog_free_name_hash_table(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error );
+
+int libesedb_catalog_build_name_hash_table(
+     libesedb_catalog_t *catalog,
+     libcerror_error_t **error );
+
+int libesedb_catalog_get_first_name_hash_entry_index(
+     libesedb_catalog_t *catalog,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libesedb_catalog_get_next_name_hash_entry_index(
+     libesedb_catalog_t *catalog,
+     uint32_t name_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
 int libesedb_catalog_get_number_of_table_definitions(
      libesedb_catalog_t *catalog,
      int *number_of_table_definitions,
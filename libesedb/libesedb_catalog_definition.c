@@ -165,6 +165,11 @@ int libesedb_catalog_definition_free(
 			memory_free(
 			 ( *catalog_definition )->default_value );
 		}
+		if( ( *catalog_definition )->key_columns_data != NULL )
+		{
+			memory_free(
+			 ( *catalog_definition )->key_columns_data );
+		}
 		memory_free(
 		 *catalog_definition );
 
@@ -425,12 +430,24 @@ int libesedb_catalog_definition_read_data(
 		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->codepage,
 		 catalog_definition->codepage );
 	}
+	if( last_fixed_size_data_type >= 6 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->flags,
+		 catalog_definition->flags );
+	}
 	if( last_fixed_size_data_type >= 10 )
 	{
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->lc_map_flags,
 		 catalog_definition->lcmap_flags );
 	}
+	if( last_fixed_size_data_type >= 11 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (esedb_data_definition_t *) fixed_size_data_type_value_data )->key_most,
+		 catalog_definition->key_most );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1043,33 +1060,75 @@ int libesedb_catalog_definition_read_data(
 #endif
 					break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
 				case 132:
-					if( libcnotify_verbose != 0 )
+					/* The MSB signifies that the variable size data type is empty
+					 */
+					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 					{
-						/* The MSB signifies that the variable size data type is empty
-						 */
-						if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+						catalog_definition->key_columns_data_size = (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+
+						catalog_definition->key_columns_data = (uint8_t *) memory_allocate(
+						                                        sizeof( uint8_t ) * catalog_definition->key_columns_data_size );
+
+						if( catalog_definition->key_columns_data == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create key columns data.",
+							 function );
+
+							catalog_definition->key_columns_data_size = 0;
+
+							return( -1 );
+						}
+						if( memory_copy(
+						     catalog_definition->key_columns_data,
+						     &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
+						     catalog_definition->key_columns_data_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to set key columns data.",
+							 function );
+
+							memory_free(
+							 catalog_definition->key_columns_data );
+
+							catalog_definition->key_columns_data      = NULL;
+							catalog_definition->key_columns_data_size = 0;
+
+							return( -1 );
+						}
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
 						{
 							libcnotify_printf(
 							 "%s: (%03" PRIu8 ") KeyFldIDs:\n",
 							 function,
 							 data_type_number );
 							libcnotify_print_data(
-							 &( variable_size_data_type_value_data[ previous_variable_size_data_type_size ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
+							 catalog_definition->key_columns_data,
+							 catalog_definition->key_columns_data_size,
 							 0 );
 						}
-						else
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
-							 function,
-							 data_type_number );
-						}
+#endif
+					}
+#if defined( HAVE_DEBUG_OUTPUT )
+					else if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: (%03" PRIu8 ") KeyFldIDs\t\t\t\t: <NULL>\n",
+						 function,
+						 data_type_number );
 					}
+#endif
 					break;
 
+#if defined( HAVE_DEBUG_OUTPUT )
 				case 133:
 					if( libcnotify_verbose != 0 )
 					{
@@ -1296,6 +1355,120 @@ int libesedb_catalog_definition_get_column_type(
 	return( 1 );
 }
 
+/* Retrieves the number of key columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_get_number_of_key_columns(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_key_columns,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_definition_get_number_of_key_columns";
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_key_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of key columns.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every key column consists of 4 bytes
+	 */
+	*number_of_key_columns = (int) ( catalog_definition->key_columns_data_size / 4 );
+
+	return( 1 );
+}
+
+/* Retrieves a specific key column
+ * The key column flags contain LIBESEDB_KEY_COLUMN_FLAG values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_get_key_column(
+     libesedb_catalog_definition_t *catalog_definition,
+     int key_column_index,
+     uint32_t *column_identifier,
+     uint8_t *key_column_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_catalog_definition_get_key_column";
+	size_t key_column_offset = 0;
+	uint16_t value_16bit     = 0;
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_column_index < 0 )
+	 || ( (size_t) key_column_index >= ( catalog_definition->key_columns_data_size / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_column_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key column flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* A key column consists of 1 byte of flags, 1 reserved byte
+	 * and a 16-bit column identifier
+	 */
+	key_column_offset = (size_t) key_column_index * 4;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( catalog_definition->key_columns_data[ key_column_offset + 2 ] ),
+	 value_16bit );
+
+	*column_identifier = (uint32_t) value_16bit;
+	*key_column_flags  = catalog_definition->key_columns_data[ key_column_offset ];
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded string string of the catalog definition name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
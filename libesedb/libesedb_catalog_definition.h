@@ -62,6 +62,10 @@ struct libesedb_catalog_definition
 	 */
 	uint32_t size;
 
+	/* The flags
+	 */
+	uint32_t flags;
+
 	/* The codepage
 	 */
 	uint32_t codepage;
@@ -70,6 +74,10 @@ struct libesedb_catalog_definition
 	 */
 	uint32_t lcmap_flags;
 
+	/* The maximum key size (key most)
+	 */
+	uint16_t key_most;
+
 	/* The name
 	 */
 	uint8_t *name;
@@ -99,6 +107,14 @@ struct libesedb_catalog_definition
 	/* The default value size
 	 */
 	size_t default_value_size;
+
+	/* The key columns data (KeyFldIDs)
+	 */
+	uint8_t *key_columns_data;
+
+	/* The key columns data size
+	 */
+	size_t key_columns_data_size;
 };
 
 int libesedb_catalog_definition_initialize(
@@ -126,6 +142,18 @@ int libesedb_catalog_definition_get_column_type(
      uint32_t *column_type,
      libcerror_error_t **error );
 
+int libesedb_catalog_definition_get_number_of_key_columns(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_key_columns,
+     libcerror_error_t **error );
+
+int libesedb_catalog_definition_get_key_column(
+     libesedb_catalog_definition_t *catalog_definition,
+     int key_column_index,
+     uint32_t *column_identifier,
+     uint8_t *key_column_flags,
+     libcerror_error_t **error );
+
 int libesedb_catalog_definition_get_utf8_name_size(
      libesedb_catalog_definition_t *catalog_definition,
      size_t *utf8_string_size,
@@ -151,11 +151,60 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	*xor_checksum_value = initial_value;
 	bitmask             = 0xff800000UL;
 	buffer             += offset;
+	buffer_iterator     = offset;
 
-	for( buffer_iterator = offset;
-	     buffer_iterator < size;
-	     buffer_iterator += 4 )
+	while( buffer_iterator < size )
 	{
+		/* Process a 16-byte block at a time when the buffer is block aligned
+		 */
+		if( ( buffer_alignment == 0 )
+		 && ( ( size - buffer_iterator ) >= 16 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ 0 ] ),
+			 value_32bit );
+
+			xor32_vertical_first ^= value_32bit;
+			xor32_value           = value_32bit;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ 4 ] ),
+			 value_32bit );
+
+			xor32_vertical_second ^= value_32bit;
+			xor32_value           ^= value_32bit;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ 8 ] ),
+			 value_32bit );
+
+			xor32_vertical_third ^= value_32bit;
+			xor32_value          ^= value_32bit;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ 12 ] ),
+			 value_32bit );
+
+			xor32_vertical_fourth ^= value_32bit;
+			xor32_value           ^= value_32bit;
+
+			/* The lookup table contains the parity of a byte
+			 * hence folding the 32-bit value into a byte preserves its parity
+			 */
+			xor32_value ^= xor32_value >> 16;
+			xor32_value ^= xor32_value >> 8;
+
+			if( libesedb_checksum_ecc32_include_lookup_table[ xor32_value & 0xff ] != 0 )
+			{
+				*ecc_checksum_value ^= bitmask;
+			}
+			bitmask         -= 0x007fff80UL;
+			buffer          += 16;
+			buffer_iterator += 16;
+			xor32_value      = 0;
+
+			continue;
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 buffer,
 		 value_32bit );
@@ -178,6 +227,7 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 		}
 		xor32_value      ^= value_32bit;
 		buffer           += 4;
+		buffer_iterator  += 4;
 		buffer_alignment += 4;
 
 		if( buffer_alignment >= 16 )
@@ -0,0 +1,705 @@
+/*
+ * Column map functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_map.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+#include "libesedb_table_definition.h"
+
+/* Creates a column map
+ * Make sure the value column_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_map_initialize(
+     libesedb_column_map_t **column_map,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_column_map_initialize";
+	uint32_t name_hash                                       = 0;
+	int bucket_index                                         = 0;
+	int column_index                                         = 0;
+	int number_of_buckets                                    = 0;
+	int number_of_columns                                    = 0;
+	int number_of_table_columns                              = 0;
+	int number_of_template_table_columns                     = 0;
+
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     template_table_definition,
+		     &number_of_template_table_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table columns.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	     table_definition,
+	     &number_of_table_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_template_table_columns < 0 )
+	 || ( number_of_template_table_columns > ( INT_MAX / 8 ) )
+	 || ( number_of_table_columns < 0 )
+	 || ( number_of_table_columns > ( INT_MAX / 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_columns = number_of_template_table_columns + number_of_table_columns;
+
+	*column_map = memory_allocate_structure(
+	               libesedb_column_map_t );
+
+	if( *column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column_map,
+	     0,
+	     sizeof( libesedb_column_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column map.",
+		 function );
+
+		memory_free(
+		 *column_map );
+
+		*column_map = NULL;
+
+		return( -1 );
+	}
+	if( number_of_columns == 0 )
+	{
+		return( 1 );
+	}
+	/* Use a power of 2 number of buckets that keeps the load factor below 0.5
+	 */
+	number_of_buckets = 16;
+
+	while( number_of_buckets < ( number_of_columns * 2 ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	( *column_map )->entries = (libesedb_column_map_entry_t *) memory_allocate(
+	                                                            sizeof( libesedb_column_map_entry_t ) * number_of_columns );
+
+	if( ( *column_map )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *column_map )->name_buckets = (int *) memory_allocate(
+	                                         sizeof( int ) * number_of_buckets );
+
+	if( ( *column_map )->name_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *column_map )->identifier_buckets = (int *) memory_allocate(
+	                                               sizeof( int ) * number_of_buckets );
+
+	if( ( *column_map )->identifier_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *column_map )->name_buckets[ bucket_index ]       = -1;
+		( *column_map )->identifier_buckets[ bucket_index ] = -1;
+	}
+	/* The columns are inserted in reverse order so that each bucket
+	 * lists its columns in value entry order
+	 */
+	for( column_index = number_of_columns - 1;
+	     column_index >= 0;
+	     column_index-- )
+	{
+		if( column_index < number_of_template_table_columns )
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     template_table_definition,
+			     column_index,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from template table.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     table_definition,
+			     column_index - number_of_template_table_columns,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from table.",
+				 function,
+				 column_index - number_of_template_table_columns );
+
+				goto on_error;
+			}
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		( *column_map )->entries[ column_index ].column_catalog_definition   = column_catalog_definition;
+		( *column_map )->entries[ column_index ].name_hash                   = 0;
+		( *column_map )->entries[ column_index ].next_name_entry_index       = -1;
+		( *column_map )->entries[ column_index ].next_identifier_entry_index = -1;
+
+		bucket_index = (int) ( column_catalog_definition->identifier & (uint32_t) ( number_of_buckets - 1 ) );
+
+		( *column_map )->entries[ column_index ].next_identifier_entry_index = ( *column_map )->identifier_buckets[ bucket_index ];
+
+		( *column_map )->identifier_buckets[ bucket_index ] = column_index;
+
+		/* A column without a name cannot be looked up by name
+		 */
+		if( column_catalog_definition->name == NULL )
+		{
+			continue;
+		}
+		if( libesedb_catalog_get_name_hash(
+		     column_catalog_definition->name,
+		     column_catalog_definition->name_size,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine name hash of column: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		bucket_index = (int) ( name_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+		( *column_map )->entries[ column_index ].name_hash             = name_hash;
+		( *column_map )->entries[ column_index ].next_name_entry_index = ( *column_map )->name_buckets[ bucket_index ];
+
+		( *column_map )->name_buckets[ bucket_index ] = column_index;
+	}
+	( *column_map )->number_of_entries = number_of_columns;
+	( *column_map )->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *column_map != NULL )
+	{
+		libesedb_column_map_free(
+		 column_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a column map
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_map_free(
+     libesedb_column_map_t **column_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_map_free";
+
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_map != NULL )
+	{
+		/* The column_catalog_definition references are freed elsewhere
+		 */
+		if( ( *column_map )->identifier_buckets != NULL )
+		{
+			memory_free(
+			 ( *column_map )->identifier_buckets );
+		}
+		if( ( *column_map )->name_buckets != NULL )
+		{
+			memory_free(
+			 ( *column_map )->name_buckets );
+		}
+		if( ( *column_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *column_map )->entries );
+		}
+		memory_free(
+		 *column_map );
+
+		*column_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the value entry of the column with a specific identifier
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_column_map_get_value_entry_by_identifier(
+     libesedb_column_map_t *column_map,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_map_get_value_entry_by_identifier";
+	int entry_index       = 0;
+
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_map->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = column_map->identifier_buckets[ column_identifier & (uint32_t) ( column_map->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		if( ( entry_index < 0 )
+		 || ( entry_index >= column_map->number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( column_map->entries[ entry_index ].column_catalog_definition->identifier == column_identifier )
+		{
+			*value_entry = entry_index;
+
+			return( 1 );
+		}
+		entry_index = column_map->entries[ entry_index ].next_identifier_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the value entry of the column with a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_column_map_get_value_entry_by_utf8_name(
+     libesedb_column_map_t *column_map,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_map_get_value_entry_by_utf8_name";
+	uint32_t name_hash    = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_map->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_catalog_get_name_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine name hash.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = column_map->name_buckets[ name_hash & (uint32_t) ( column_map->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		if( ( entry_index < 0 )
+		 || ( entry_index >= column_map->number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( column_map->entries[ entry_index ].name_hash == name_hash )
+		{
+			result = libesedb_catalog_definition_compare_name_with_utf8_string(
+			          column_map->entries[ entry_index ].column_catalog_definition,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-8 string with column: %d name.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*value_entry = entry_index;
+
+				return( 1 );
+			}
+		}
+		entry_index = column_map->entries[ entry_index ].next_name_entry_index;
+	}
+	return( 0 );
+}
+
+/* Retrieves the value entry of the column with a specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_column_map_get_value_entry_by_utf16_name(
+     libesedb_column_map_t *column_map,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_map_get_value_entry_by_utf16_name";
+	uint32_t name_hash    = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_map->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_catalog_get_utf16_name_hash(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine name hash.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = column_map->name_buckets[ name_hash & (uint32_t) ( column_map->number_of_buckets - 1 ) ];
+
+	while( entry_index != -1 )
+	{
+		if( ( entry_index < 0 )
+		 || ( entry_index >= column_map->number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( column_map->entries[ entry_index ].name_hash == name_hash )
+		{
+			result = libesedb_catalog_definition_compare_name_with_utf16_string(
+			          column_map->entries[ entry_index ].column_catalog_definition,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 string with column: %d name.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*value_entry = entry_index;
+
+				return( 1 );
+			}
+		}
+		entry_index = column_map->entries[ entry_index ].next_name_entry_index;
+	}
+	return( 0 );
+}
+
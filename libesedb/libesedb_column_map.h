@@ -0,0 +1,120 @@
+/*
+ * Column map functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBESEDB_COLUMN_MAP_H )
+#define _LIBESEDB_COLUMN_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_column_map_entry libesedb_column_map_entry_t;
+
+struct libesedb_column_map_entry
+{
+	/* The column catalog definition
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The index of the next entry in the same name bucket or -1
+	 */
+	int next_name_entry_index;
+
+	/* The index of the next entry in the same identifier bucket or -1
+	 */
+	int next_identifier_entry_index;
+};
+
+typedef struct libesedb_column_map libesedb_column_map_t;
+
+struct libesedb_column_map
+{
+	/* The entries
+	 * contains an entry for every column catalog definition index
+	 * where the columns of the template table precede those of the table
+	 */
+	libesedb_column_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The name buckets, contains the index of the first entry per bucket or -1
+	 */
+	int *name_buckets;
+
+	/* The identifier buckets, contains the index of the first entry per bucket or -1
+	 */
+	int *identifier_buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+};
+
+int libesedb_column_map_initialize(
+     libesedb_column_map_t **column_map,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error );
+
+int libesedb_column_map_free(
+     libesedb_column_map_t **column_map,
+     libcerror_error_t **error );
+
+int libesedb_column_map_get_value_entry_by_identifier(
+     libesedb_column_map_t *column_map,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error );
+
+int libesedb_column_map_get_value_entry_by_utf8_name(
+     libesedb_column_map_t *column_map,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
+int libesedb_column_map_get_value_entry_by_utf16_name(
+     libesedb_column_map_t *column_map,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_COLUMN_MAP_H ) */
+
@@ -0,0 +1,423 @@
+/*
+ * Column projection functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+/* Creates a column projection
+ * Make sure the value column_projection is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_initialize(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_initialize";
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_projection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column projection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*column_projection = memory_allocate_structure(
+	                      libesedb_column_projection_t );
+
+	if( *column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column projection.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column_projection,
+	     0,
+	     sizeof( libesedb_column_projection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column projection.",
+		 function );
+
+		goto on_error;
+	}
+	( *column_projection )->last_column_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *column_projection != NULL )
+	{
+		memory_free(
+		 *column_projection );
+
+		*column_projection = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_free(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_free";
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_projection != NULL )
+	{
+		if( ( *column_projection )->columns != NULL )
+		{
+			memory_free(
+			 ( *column_projection )->columns );
+		}
+		memory_free(
+		 *column_projection );
+
+		*column_projection = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a column projection
+ * A cleared column projection projects all columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_clear(
+     libesedb_column_projection_t *column_projection,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_column_projection_clear";
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_projection->columns != NULL )
+	{
+		memory_free(
+		 column_projection->columns );
+
+		column_projection->columns = NULL;
+	}
+	column_projection->number_of_columns = 0;
+	column_projection->last_column_index = -1;
+
+	return( 1 );
+}
+
+/* Sets the column identifiers of the columns to project
+ * The columns are mapped to the column catalog definition indexes as used by the records,
+ * where the columns of the template table precede those of the table
+ * Setting 0 column identifiers clears the column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_column_projection_set_column_identifiers(
+     libesedb_column_projection_t *column_projection,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	uint8_t *columns                                         = NULL;
+	static char *function                                    = "libesedb_column_projection_set_column_identifiers";
+	int column_identifier_index                              = 0;
+	int column_index                                         = 0;
+	int last_column_index                                    = -1;
+	int number_of_columns                                    = 0;
+	int number_of_projected_columns                          = 0;
+	int number_of_table_columns                              = 0;
+	int number_of_template_table_columns                     = 0;
+
+	if( column_projection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column projection.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_column_identifiers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of column identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_identifiers == NULL )
+	 && ( number_of_column_identifiers > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_column_identifiers == 0 )
+	{
+		return( libesedb_column_projection_clear(
+		         column_projection,
+		         error ) );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     template_table_definition,
+		     &number_of_template_table_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	     table_definition,
+	     &number_of_table_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table columns.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_columns = number_of_template_table_columns + number_of_table_columns;
+
+	if( number_of_columns == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing columns.",
+		 function );
+
+		goto on_error;
+	}
+	columns = (uint8_t *) memory_allocate(
+	                       sizeof( uint8_t ) * number_of_columns );
+
+	if( columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     columns,
+	     0,
+	     sizeof( uint8_t ) * number_of_columns ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear columns.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		if( column_index < number_of_template_table_columns )
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     template_table_definition,
+			     column_index,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from template table.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     table_definition,
+			     column_index - number_of_template_table_columns,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from table.",
+				 function,
+				 column_index - number_of_template_table_columns );
+
+				goto on_error;
+			}
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		for( column_identifier_index = 0;
+		     column_identifier_index < number_of_column_identifiers;
+		     column_identifier_index++ )
+		{
+			if( column_identifiers[ column_identifier_index ] == column_catalog_definition->identifier )
+			{
+				columns[ column_index ] = 1;
+				last_column_index       = column_index;
+
+				number_of_projected_columns++;
+
+				break;
+			}
+		}
+	}
+	if( number_of_projected_columns == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column identifiers - no matching columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( column_projection->columns != NULL )
+	{
+		memory_free(
+		 column_projection->columns );
+	}
+	column_projection->columns           = columns;
+	column_projection->number_of_columns = number_of_columns;
+	column_projection->last_column_index = last_column_index;
+
+	return( 1 );
+
+on_error:
+	if( columns != NULL )
+	{
+		memory_free(
+		 columns );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * Column projection functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_COLUMN_PROJECTION_H )
+#define _LIBESEDB_COLUMN_PROJECTION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_column_projection libesedb_column_projection_t;
+
+struct libesedb_column_projection
+{
+	/* The projected columns
+	 * contains a value for every column catalog definition index
+	 * where a value of 0 indicates the column is not projected
+	 */
+	uint8_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The last projected column index
+	 * columns after the last projected column are not read
+	 */
+	int last_column_index;
+};
+
+int libesedb_column_projection_initialize(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_free(
+     libesedb_column_projection_t **column_projection,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_clear(
+     libesedb_column_projection_t *column_projection,
+     libcerror_error_t **error );
+
+int libesedb_column_projection_set_column_identifiers(
+     libesedb_column_projection_t *column_projection,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_COLUMN_PROJECTION_H ) */
+
@@ -29,6 +29,7 @@
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfwnt.h"
 #include "libesedb_libuna.h"
+#include "libesedb_lzxpress.h"
 
 /* Retrieves the uncompressed size of the 7-bit compressed data
  * Returns 1 on success or -1 on error
@@ -115,6 +116,7 @@ int libesedb_compression_7bit_decompress(
 	static char *function          = "libesedb_compression_7bit_decompress";
 	size_t compressed_data_index   = 0;
 	size_t uncompressed_data_index = 0;
+	uint64_t value_64bit           = 0;
 	uint16_t value_16bit           = 0;
 	uint8_t bit_index              = 0;
 
@@ -196,9 +198,42 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
+	/* Every 7 bytes of compressed data contain exactly 8 codes of 7 bits
+	 * hence the data is decompressed a block of 7 bytes at a time
+	 */
+	compressed_data_index = 1;
+
+	while( ( compressed_data_size - compressed_data_index ) >= 7 )
+	{
+		value_64bit = (uint64_t) compressed_data[ compressed_data_index + 6 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index + 5 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index + 4 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index + 3 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index + 2 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index + 1 ];
+		value_64bit <<= 8;
+		value_64bit |= (uint64_t) compressed_data[ compressed_data_index ];
+
+		uncompressed_data[ uncompressed_data_index     ] = (uint8_t) ( value_64bit & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 1 ] = (uint8_t) ( ( value_64bit >> 7 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 2 ] = (uint8_t) ( ( value_64bit >> 14 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 3 ] = (uint8_t) ( ( value_64bit >> 21 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 4 ] = (uint8_t) ( ( value_64bit >> 28 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 5 ] = (uint8_t) ( ( value_64bit >> 35 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 6 ] = (uint8_t) ( ( value_64bit >> 42 ) & 0x7f );
+		uncompressed_data[ uncompressed_data_index + 7 ] = (uint8_t) ( ( value_64bit >> 49 ) & 0x7f );
+
+		compressed_data_index   += 7;
+		uncompressed_data_index += 8;
+	}
+	/* The remaining compressed data is decompressed a byte at a time
+	 */
+	while( compressed_data_index < compressed_data_size )
 	{
 		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
 
@@ -216,6 +251,7 @@ int libesedb_compression_7bit_decompress(
 
 			bit_index = 0;
 		}
+		compressed_data_index++;
 	}
 	if( value_16bit != 0 )
 	{
@@ -307,6 +343,8 @@ int libesedb_compression_lzxpress_decompress_get_size(
 }
 
 /* Decompresses LZXPRESS compressed data
+ * If HAVE_LZXPRESS_FALLBACK is defined the data is decompressed with libfwnt
+ * when the built-in decompression fails
  * Returns 1 on success or -1 on error
  */
 int libesedb_compression_lzxpress_decompress(
@@ -316,7 +354,9 @@ int libesedb_compression_lzxpress_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_lzxpress_decompress";
+	static char *function              = "libesedb_compression_lzxpress_decompress";
+	size_t safe_uncompressed_data_size = 0;
+	int result                         = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -352,12 +392,50 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
-	if( libfwnt_lzxpress_decompress(
-	     &( compressed_data[ 3 ] ),
-	     compressed_data_size - 3,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     error ) != 1 )
+	safe_uncompressed_data_size = uncompressed_data_size;
+
+	result = libesedb_lzxpress_decompress(
+	          &( compressed_data[ 3 ] ),
+	          compressed_data_size - 3,
+	          uncompressed_data,
+	          &safe_uncompressed_data_size,
+	          error );
+
+#if defined( HAVE_LZXPRESS_FALLBACK )
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZXPRESS compressed data.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		/* Fall back to the libfwnt implementation
+		 */
+		safe_uncompressed_data_size = uncompressed_data_size;
+
+		result = libfwnt_lzxpress_decompress(
+		          &( compressed_data[ 3 ] ),
+		          compressed_data_size - 3,
+		          uncompressed_data,
+		          &safe_uncompressed_data_size,
+		          error );
+	}
+#endif /* defined( HAVE_LZXPRESS_FALLBACK ) */
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -524,70 +602,59 @@ int libesedb_compression_decompress(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 string size of compressed data
+/* Decompresses compressed data into a newly allocated buffer
+ * Make sure the value uncompressed_data is referencing, is set to NULL
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_get_utf8_string_size(
+int libesedb_compression_decompress_data(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *utf8_string_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_get_utf8_string_size";
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t *safe_uncompressed_data    = NULL;
+	static char *function              = "libesedb_compression_decompress_data";
+	size_t safe_uncompressed_data_size = 0;
 
-	if( compressed_data == NULL )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( *uncompressed_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size < 1 )
+	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_decompress_get_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -598,10 +665,10 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
+	safe_uncompressed_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * safe_uncompressed_data_size );
 
-	if( uncompressed_data == NULL )
+	if( safe_uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -612,25 +679,12 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	if( result != 1 )
+	if( libesedb_compression_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     safe_uncompressed_data,
+	     safe_uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -641,11 +695,59 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	result = 0;
+	*uncompressed_data      = safe_uncompressed_data;
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_uncompressed_data != NULL )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-8 string size of uncompressed data
+ * The leading byte of the compressed data determines the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf8_string_size_from_uncompressed_data";
+	int result            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
 		result = libuna_utf8_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -692,39 +794,24 @@ int libesedb_compression_get_utf8_string_size(
 			 "%s: unable to determine UTF-8 string size of UTF-8 stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
-/* Copies compressed data to an UTF-8 string
+/* Retrieves the UTF-8 string size of compressed data
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_copy_to_utf8_string(
+int libesedb_compression_get_utf8_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf8_string";
+	static char *function         = "libesedb_compression_get_utf8_string_size";
 	size_t uncompressed_data_size = 0;
-	int result                    = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -737,103 +824,92 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size < 1 )
+	if( libesedb_compression_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
 		 function );
 
-		return( -1 );
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		goto on_error;
 	}
-	if( result != 1 )
+	if( libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+	     compressed_data[ 0 ],
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve uncompressed data size.",
+		 "%s: unable to determine UTF-8 string size.",
 		 function );
 
 		goto on_error;
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-8 string
+ * The leading byte of the compressed data determines the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_to_utf8_string_from_uncompressed_data";
+	int result            = 0;
 
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
-		goto on_error;
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = 0;
-
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
 		result = libuna_utf8_string_copy_from_utf16_stream(
 			  utf8_string,
@@ -882,38 +958,25 @@ int libesedb_compression_copy_to_utf8_string(
 			 "%s: unable to copy UTF-8 stream to UTF-8 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
-/* Retrieves the UTF-16 string size of compressed data
+/* Copies compressed data to an UTF-8 string
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_get_utf16_string_size(
+int libesedb_compression_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_get_utf16_string_size";
+	static char *function         = "libesedb_compression_copy_to_utf8_string";
 	size_t uncompressed_data_size = 0;
-	int result                    = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -926,103 +989,92 @@ int libesedb_compression_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( libesedb_compression_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( compressed_data_size < 1 )
+	if( libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+	     compressed_data[ 0 ],
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-8 string.",
 		 function );
 
-		return( -1 );
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		goto on_error;
 	}
-	else
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		memory_free(
+		 uncompressed_data );
 	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve uncompressed data size.",
-		 function );
+	return( -1 );
+}
 
-		goto on_error;
-	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
+/* Retrieves the UTF-16 string size of uncompressed data
+ * The leading byte of the compressed data determines the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_get_utf16_string_size_from_uncompressed_data";
+	int result            = 0;
 
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
-		goto on_error;
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = 0;
-
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -1069,39 +1121,24 @@ int libesedb_compression_get_utf16_string_size(
 			 "%s: unable to determine UTF-16 string size of UTF-8 stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
-
 	return( 1 );
-
-on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	return( -1 );
 }
 
-/* Copies compressed data to an UTF-16 string
+/* Retrieves the UTF-16 string size of compressed data
  * Returns 1 on success or -1 on error
  */
-int libesedb_compression_copy_to_utf16_string(
+int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf16_string";
+	static char *function         = "libesedb_compression_get_utf16_string_size";
 	size_t uncompressed_data_size = 0;
-	int result                    = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -1114,103 +1151,92 @@ int libesedb_compression_copy_to_utf16_string(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size < 1 )
+	if( libesedb_compression_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
 		 function );
 
-		return( -1 );
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		goto on_error;
 	}
-	if( result != 1 )
+	if( libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+	     compressed_data[ 0 ],
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf16_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve uncompressed data size.",
+		 "%s: unable to determine UTF-16 string size.",
 		 function );
 
 		goto on_error;
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-					 sizeof( uint8_t ) * uncompressed_data_size );
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Copies uncompressed data to an UTF-16 string
+ * The leading byte of the compressed data determines the encoding of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_compression_copy_to_utf16_string_from_uncompressed_data";
+	int result            = 0;
 
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
-		goto on_error;
-	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		return( -1 );
 	}
-	if( result != 1 )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable decompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = 0;
-
 	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	 && ( ( leading_byte == 0x18 )
+	  ||  ( ( leading_byte & 0x10 ) == 0 ) ) )
 	{
 		result = libuna_utf16_string_copy_from_utf16_stream(
 			  utf16_string,
@@ -1256,17 +1282,76 @@ int libesedb_compression_copy_to_utf16_string(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 "%s: unable to copy UTF-8 stream to UTF-16 string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
+	return( 1 );
+}
+
+/* Copies compressed data to an UTF-16 string
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_copy_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "libesedb_compression_copy_to_utf16_string";
+	size_t uncompressed_data_size = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_compression_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     &uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+	     compressed_data[ 0 ],
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data to UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
 	memory_free(
 	 uncompressed_data );
 
-	uncompressed_data = NULL;
-
 	return( 1 );
 
 on_error:
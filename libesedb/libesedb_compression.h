@@ -70,12 +70,34 @@ int libesedb_compression_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_decompress_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf8_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf8_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -83,12 +105,27 @@ int libesedb_compression_copy_to_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_get_utf16_string_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+     uint8_t leading_byte,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_copy_to_utf16_string(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
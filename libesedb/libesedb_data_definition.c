@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_column_type.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
@@ -138,6 +139,16 @@ int libesedb_data_definition_free(
 	}
 	if( *data_definition != NULL )
 	{
+		if( ( *data_definition )->value_descriptors != NULL )
+		{
+			memory_free(
+			 ( *data_definition )->value_descriptors );
+		}
+		if( ( *data_definition )->record_data != NULL )
+		{
+			memory_free(
+			 ( *data_definition )->record_data );
+		}
 		memory_free(
 		 *data_definition );
 
@@ -162,7 +173,6 @@ int libesedb_data_definition_read_data(
 	libesedb_page_t *page             = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_data_definition_read_data";
-	off64_t element_data_offset       = 0;
 	uint16_t data_offset              = 0;
 
 	if( data_definition == NULL )
@@ -209,14 +219,13 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
+	if( libesedb_page_get_from_pages_vector(
 	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     pages_cache,
+	     io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -302,7 +311,15 @@ int libesedb_data_definition_read_data(
 
 /* Reads the record
  * Uses the definition data in the catalog definitions
- * Returns 1 if successful or -1 on error
+ * Only the fixed, variable and tagged data type offsets are read, the record values
+ * are created on demand by libesedb_data_definition_get_record_value
+ * The values array is resized to the number of columns and its entries are left empty
+ * If a column projection is provided only the projected columns are read, the other
+ * columns are read as if they were empty
+ * If a record filter is provided its conditions are evaluated on the stored column data
+ * as soon as the last column used by the record filter has been read, the record data
+ * is only copied if the record is not rejected
+ * Returns 1 if successful, 0 if the record is rejected by the record filter or -1 on error
  */
 int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
@@ -312,6 +329,8 @@ int libesedb_data_definition_read_record(
      libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
+     libesedb_internal_record_filter_t *record_filter,
      libcdata_array_t *values_array,
      uint8_t *record_flags,
      libcerror_error_t **error )
@@ -319,14 +338,15 @@ int libesedb_data_definition_read_record(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_page_t *page                                    = NULL;
 	libesedb_page_value_t *page_value                        = NULL;
-	libfvalue_data_handle_t *value_data_handle               = NULL;
-	libfvalue_value_t *record_value                          = NULL;
+	libesedb_record_value_descriptor_t *value_descriptor     = NULL;
+	libesedb_record_value_descriptor_t skipped_value_descriptor;
 	uint8_t *record_data                                     = NULL;
+	uint8_t *value_data                                      = NULL;
 	uint8_t *tagged_data_type_offset_data                    = NULL;
 	static char *function                                    = "libesedb_data_definition_read_record";
 	size_t record_data_size                                  = 0;
 	size_t remaining_definition_data_size                    = 0;
-	off64_t element_data_offset                              = 0;
+	uint64_t condition_results                               = 0;
 	uint16_t data_offset                                     = 0;
 	uint16_t fixed_size_data_type_value_offset               = 0;
 	uint16_t masked_previous_tagged_data_type_offset         = 0;
@@ -355,7 +375,9 @@ int libesedb_data_definition_read_record(
 	int number_of_column_catalog_definitions                 = 0;
 	int number_of_table_column_catalog_definitions           = 0;
 	int number_of_template_table_column_catalog_definitions  = 0;
+	int read_column_data                                     = 0;
 	int record_value_codepage                                = 0;
+	int result                                               = 1;
 
 	if( data_definition == NULL )
 	{
@@ -368,6 +390,28 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	if( data_definition->record_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data definition - record data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition->value_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data definition - value descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -412,14 +456,13 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
+	if( libesedb_page_get_from_pages_vector(
 	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     pages_cache,
+	     io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -511,6 +554,17 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	if( record_data_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
 	if( ( io_handle->format_version == 0x620 )
 	 && ( io_handle->format_revision <= 2 ) )
 	{
@@ -610,6 +664,50 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	if( number_of_column_catalog_definitions > 0 )
+	{
+		if( (size_t) number_of_column_catalog_definitions > ( (size_t) SSIZE_MAX / sizeof( libesedb_record_value_descriptor_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of column catalog definitions value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		data_definition->value_descriptors = (libesedb_record_value_descriptor_t *) memory_allocate(
+		                                                                             sizeof( libesedb_record_value_descriptor_t ) * number_of_column_catalog_definitions );
+
+		if( data_definition->value_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     data_definition->value_descriptors,
+		     0,
+		     sizeof( libesedb_record_value_descriptor_t ) * number_of_column_catalog_definitions ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value descriptors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_definition->number_of_value_descriptors = number_of_column_catalog_definitions;
+
 	if( last_variable_size_data_type > 127 )
 	{
 		number_of_variable_size_data_types = last_variable_size_data_type - 127;
@@ -623,6 +721,22 @@ int libesedb_data_definition_read_record(
 	     column_catalog_definition_index < number_of_column_catalog_definitions;
 	     column_catalog_definition_index++ )
 	{
+		/* The data of columns after the last projected column does not need to be read
+		 */
+		read_column_data = 1;
+
+		if( ( column_projection != NULL )
+		 && ( column_projection->columns != NULL )
+		 && ( column_catalog_definition_index > column_projection->last_column_index ) )
+		{
+			/* The columns used by the record filter are still read
+			 */
+			if( ( record_filter == NULL )
+			 || ( column_catalog_definition_index > record_filter->last_column_entry ) )
+			{
+				read_column_data = 0;
+			}
+		}
 		if( ( template_table_definition != NULL )
 		 && ( column_catalog_definition_index < number_of_template_table_column_catalog_definitions ) )
 		{
@@ -802,20 +916,10 @@ int libesedb_data_definition_read_record(
 
 				goto on_error;
 		}
-		if( libfvalue_data_handle_initialize(
-		     &value_data_handle,
-		     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value data handle.",
-			 function );
+		value_descriptor = &( data_definition->value_descriptors[ column_catalog_definition_index ] );
+
+		value_descriptor->value_type = record_value_type;
 
-			goto on_error;
-		}
 		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
 		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
 		{
@@ -840,6 +944,38 @@ int libesedb_data_definition_read_record(
 		{
 			encoding = LIBFVALUE_ENDIAN_LITTLE;
 		}
+		value_descriptor->encoding = encoding;
+
+		if( read_column_data == 0 )
+		{
+			continue;
+		}
+		if( ( column_projection != NULL )
+		 && ( column_projection->columns != NULL ) )
+		{
+			if( ( column_catalog_definition_index >= column_projection->number_of_columns )
+			 || ( column_projection->columns[ column_catalog_definition_index ] == 0 ) )
+			{
+				/* The offsets of a column that is not projected are still read
+				 * but the column is stored as an empty value of the column type
+				 */
+				if( memory_set(
+				     &skipped_value_descriptor,
+				     0,
+				     sizeof( libesedb_record_value_descriptor_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear skipped value descriptor.",
+					 function );
+
+					goto on_error;
+				}
+				value_descriptor = &skipped_value_descriptor;
+			}
+		}
 		if( column_catalog_definition->identifier <= 127 )
 		{
 			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
@@ -858,34 +994,32 @@ int libesedb_data_definition_read_record(
 					 0 );
 				}
 #endif
-				if( libfvalue_data_handle_set_data(
-				     value_data_handle,
-				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
-				     encoding,
-				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-				     error ) != 1 )
+				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data in fixed size data type definition.",
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid common catalog definition size value exceeds maximum.",
 					 function );
 
 					goto on_error;
 				}
-				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+				if( ( (size_t) fixed_size_data_type_value_offset + column_catalog_definition->size ) > record_data_size )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid common catalog definition size value exceeds maximum.",
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid fixed size data type size value out of bounds.",
 					 function );
 
 					goto on_error;
 				}
+				value_descriptor->data_offset = fixed_size_data_type_value_offset;
+				value_descriptor->data_size   = (uint16_t) column_catalog_definition->size;
+				value_descriptor->has_data    = 1;
+
 				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
 			}
 		}
@@ -931,23 +1065,21 @@ int libesedb_data_definition_read_record(
 							 0 );
 						}
 #endif
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ variable_size_data_type_value_offset ] ),
-						     variable_size_data_type_size - previous_variable_size_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) variable_size_data_type_value_offset + (uint16_t) ( variable_size_data_type_size - previous_variable_size_data_type_size ) ) > record_data_size )
 						{
 							libcerror_error_set(
 							 error,
 							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in variable size data type definition.",
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid variable size data type size value out of bounds.",
 							 function );
 
 							goto on_error;
 						}
+						value_descriptor->data_offset = variable_size_data_type_value_offset;
+						value_descriptor->data_size   = (uint16_t) ( variable_size_data_type_size - previous_variable_size_data_type_size );
+						value_descriptor->has_data    = 1;
+
 						variable_size_data_type_value_offset += variable_size_data_type_size - previous_variable_size_data_type_size;
 						previous_variable_size_data_type_size = variable_size_data_type_size;
 					}
@@ -1037,20 +1169,9 @@ int libesedb_data_definition_read_record(
 							 "\n" );
 						}
 #endif
-						if( libfvalue_data_handle_set_data_flags(
-						     value_data_handle,
-						     (uint32_t) record_data[ tagged_data_type_value_offset ],
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set tagged data type flags in tagged data type definition.",
-							 function );
+						value_descriptor->data_flags     = record_data[ tagged_data_type_value_offset ];
+						value_descriptor->has_data_flags = 1;
 
-							goto on_error;
-						}
 						tagged_data_type_value_offset  += 1;
 						tagged_data_type_size           = ( tagged_data_type_size & 0x5fff ) - 1;
 						remaining_definition_data_size -= 1;
@@ -1111,23 +1232,20 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) tagged_data_type_value_offset + tagged_data_type_size ) > record_data_size )
 						{
 							libcerror_error_set(
 							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type size value out of bounds.",
 							 function );
 
 							goto on_error;
 						}
+						value_descriptor->data_offset = tagged_data_type_value_offset;
+						value_descriptor->data_size   = tagged_data_type_size;
+						value_descriptor->has_data    = 1;
 						remaining_definition_data_size -= tagged_data_type_size;
 					}
 					if( remaining_definition_data_size > 0 )
@@ -1318,20 +1436,9 @@ int libesedb_data_definition_read_record(
 
 								goto on_error;
 							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
+							value_descriptor->data_flags     = record_data[ tagged_data_type_value_offset ];
+							value_descriptor->has_data_flags = 1;
 
-								goto on_error;
-							}
 							tagged_data_type_value_offset += 1;
 							tagged_data_type_size         -= 1;
 						}
@@ -1382,62 +1489,77 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( ( (size_t) tagged_data_type_value_offset + tagged_data_type_size ) > record_data_size )
 						{
 							libcerror_error_set(
 							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type size value out of bounds.",
 							 function );
 
 							goto on_error;
 						}
+						value_descriptor->data_offset = tagged_data_type_value_offset;
+						value_descriptor->data_size   = tagged_data_type_size;
+						value_descriptor->has_data    = 1;
 					}
 				}
 			}
 		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-		     error ) != 1 )
+		if( record_filter != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
+			value_data = NULL;
 
-			goto on_error;
-		}
-		value_data_handle = NULL;
+			if( value_descriptor->has_data != 0 )
+			{
+				value_data = &( record_data[ value_descriptor->data_offset ] );
+			}
+			if( libesedb_record_filter_evaluate_column(
+			     record_filter,
+			     column_catalog_definition_index,
+			     value_data,
+			     (size_t) value_descriptor->data_size,
+			     ( value_descriptor->has_data_flags != 0 ) ? value_descriptor->data_flags : 0,
+			     &condition_results,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to evaluate record filter conditions of column: %d.",
+				 function,
+				 column_catalog_definition_index );
 
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
+				goto on_error;
+			}
+			/* The record filter is evaluated as soon as the last column it uses has been read
+			 */
+			if( column_catalog_definition_index == record_filter->last_column_entry )
+			{
+				result = libesedb_record_filter_evaluate_expression(
+				          record_filter,
+				          condition_results,
+				          error );
 
-			goto on_error;
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to evaluate record filter.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+			}
 		}
-		record_value = NULL;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1456,15 +1578,254 @@ int libesedb_data_definition_read_record(
 		 "\n" );
 	}
 #endif
+	/* The conditions on columns that are not in the record are evaluated without data
+	 */
+	if( ( record_filter != NULL )
+	 && ( record_filter->last_column_entry >= number_of_column_catalog_definitions ) )
+	{
+		result = libesedb_record_filter_evaluate_expression(
+		          record_filter,
+		          condition_results,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate record filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		/* A record rejected by the record filter is not returned, hence its data
+		 * is not copied and its value descriptors are freed
+		 */
+		if( data_definition->value_descriptors != NULL )
+		{
+			memory_free(
+			 data_definition->value_descriptors );
+
+			data_definition->value_descriptors = NULL;
+		}
+		data_definition->number_of_value_descriptors = 0;
+
+		return( 0 );
+	}
+	/* The record data is copied so that the column values can be created on demand
+	 * without having to keep the page in the cache
+	 */
+	data_definition->record_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * record_data_size );
+
+	if( data_definition->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data_definition->record_data,
+	     record_data,
+	     record_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data.",
+		 function );
+
+		goto on_error;
+	}
+	data_definition->record_data_size = record_data_size;
+
 	return( 1 );
 
 on_error:
-	if( record_value != NULL )
+	if( data_definition->value_descriptors != NULL )
 	{
-		libfvalue_value_free(
-		 &record_value,
-		 NULL );
+		memory_free(
+		 data_definition->value_descriptors );
+
+		data_definition->value_descriptors = NULL;
+	}
+	data_definition->number_of_value_descriptors = 0;
+
+	if( data_definition->record_data != NULL )
+	{
+		memory_free(
+		 data_definition->record_data );
+
+		data_definition->record_data = NULL;
 	}
+	data_definition->record_data_size = 0;
+
+	return( -1 );
+}
+
+/* Creates the record value of a specific column
+ * The record value is created from the record data read by libesedb_data_definition_read_record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_record_value(
+     libesedb_data_definition_t *data_definition,
+     int value_index,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libesedb_record_value_descriptor_t *value_descriptor = NULL;
+	libfvalue_data_handle_t *value_data_handle           = NULL;
+	static char *function                                = "libesedb_data_definition_get_record_value";
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data definition - missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= data_definition->number_of_value_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	value_descriptor = &( data_definition->value_descriptors[ value_index ] );
+
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_descriptor->has_data_flags != 0 )
+	{
+		if( libfvalue_data_handle_set_data_flags(
+		     value_data_handle,
+		     (uint32_t) value_descriptor->data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data flags in value data handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( value_descriptor->has_data != 0 )
+	{
+		if( ( (size_t) value_descriptor->data_offset + value_descriptor->data_size ) > data_definition->record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value descriptor - data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_data_handle_set_data(
+		     value_data_handle,
+		     &( data_definition->record_data[ value_descriptor->data_offset ] ),
+		     (size_t) value_descriptor->data_size,
+		     value_descriptor->encoding,
+		     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data in value data handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     record_value,
+	     (int) value_descriptor->value_type,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
 	if( value_data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -1474,12 +1835,223 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a reference to the data of a specific record value
+ * The data references the record data and remains valid until the data definition is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_record_value_data_reference(
+     libesedb_data_definition_t *data_definition,
+     int value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_record_value_descriptor_t *value_descriptor = NULL;
+	static char *function                                = "libesedb_data_definition_get_record_value_data_reference";
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data definition - missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= data_definition->number_of_value_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	value_descriptor = &( data_definition->value_descriptors[ value_index ] );
+
+	if( ( value_descriptor->has_data == 0 )
+	 || ( value_descriptor->data_size == 0 ) )
+	{
+		*value_data      = NULL;
+		*value_data_size = 0;
+
+		return( 1 );
+	}
+	if( ( (size_t) value_descriptor->data_offset + value_descriptor->data_size ) > data_definition->record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value descriptor - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data      = &( data_definition->record_data[ value_descriptor->data_offset ] );
+	*value_data_size = (size_t) value_descriptor->data_size;
+
+	return( 1 );
+}
+
+/* Reads the data of a fixed size value directly from the record data in the page
+ * The value data offset is relative to the start of the record data and
+ * is determined by the sizes of the preceding fixed size columns
+ * The value data references the page data and is valid until the page
+ * is removed from the pages cache
+ * Returns 1 if successful, 0 if the record has no value for the column or -1 on error
+ */
+int libesedb_data_definition_read_fixed_size_value_data(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t column_identifier,
+     uint16_t value_data_offset,
+     uint16_t value_data_size,
+     const uint8_t **value_data,
+     libcerror_error_t **error )
+{
+	uint8_t *record_data              = NULL;
+	static char *function             = "libesedb_data_definition_read_fixed_size_value_data";
+	size_t record_data_size           = 0;
+	uint8_t last_fixed_size_data_type = 0;
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_identifier == 0 )
+	 || ( column_identifier > 127 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column identifier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     data_definition,
+	     file_io_handle,
+	     io_handle,
+	     pages_vector,
+	     pages_cache,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	last_fixed_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
+
+	/* Fixed size columns after the last fixed size data type are not stored in the record
+	 */
+	if( column_identifier > (uint32_t) last_fixed_size_data_type )
+	{
+		return( 0 );
+	}
+	if( ( (size_t) value_data_offset < sizeof( esedb_data_definition_header_t ) )
+	 || ( ( (size_t) value_data_offset + value_data_size ) > record_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid fixed size data type size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data = &( record_data[ value_data_offset ] );
+
+	return( 1 );
+}
+
 /* Reads the long value
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
@@ -1489,7 +2061,6 @@ int libesedb_data_definition_read_long_value(
 	uint8_t *long_value_data          = NULL;
 	static char *function             = "libesedb_data_definition_read_long_value";
 	size_t long_value_data_size       = 0;
-	off64_t element_data_offset       = 0;
 	uint32_t value_32bit              = 0;
 	uint16_t data_offset              = 0;
 
@@ -1504,14 +2075,13 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
+	if( libesedb_page_get_from_pages_vector(
 	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     pages_cache,
+	     io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1668,7 +2238,6 @@ int libesedb_data_definition_read_long_value_segment(
 	libesedb_page_t *page                  = NULL;
 	libesedb_page_value_t *page_value      = NULL;
 	static char *function                  = "libesedb_data_definition_read_long_value_segment";
-	off64_t element_data_offset            = 0;
 	off64_t long_value_segment_data_offset = 0;
 	size64_t data_size                     = 0;
 	size_t long_value_segment_data_size    = 0;
@@ -1697,14 +2266,13 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
+	if( libesedb_page_get_from_pages_vector(
 	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     pages_cache,
+	     io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -25,18 +25,54 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_column_projection.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libesedb_record_value_descriptor libesedb_record_value_descriptor_t;
+
+struct libesedb_record_value_descriptor
+{
+	/* The data offset relative to the start of the record data
+	 */
+	uint16_t data_offset;
+
+	/* The data size
+	 */
+	uint16_t data_size;
+
+	/* The encoding
+	 */
+	int encoding;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The (tagged data type) data flags
+	 */
+	uint8_t data_flags;
+
+	/* Value to indicate the value has data
+	 */
+	uint8_t has_data;
+
+	/* Value to indicate the value has data flags
+	 */
+	uint8_t has_data_flags;
+};
+
 typedef struct libesedb_data_definition libesedb_data_definition_t;
 
 struct libesedb_data_definition
@@ -60,6 +96,22 @@ struct libesedb_data_definition
 	/* The data size
 	 */
 	uint16_t data_size;
+
+	/* The record data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The record value descriptors
+	 */
+	libesedb_record_value_descriptor_t *value_descriptors;
+
+	/* The number of record value descriptors
+	 */
+	int number_of_value_descriptors;
 };
 
 int libesedb_data_definition_initialize(
@@ -88,13 +140,41 @@ int libesedb_data_definition_read_record(
      libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
+     libesedb_internal_record_filter_t *record_filter,
      libcdata_array_t *values_array,
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_record_value(
+     libesedb_data_definition_t *data_definition,
+     int value_index,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_record_value_data_reference(
+     libesedb_data_definition_t *data_definition,
+     int value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_read_fixed_size_value_data(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint32_t column_identifier,
+     uint16_t value_data_offset,
+     uint16_t value_data_size,
+     const uint8_t **value_data,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
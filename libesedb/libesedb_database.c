@@ -455,13 +455,13 @@ int libesedb_database_read_file_io_handle(
 	}
 	while( leaf_page_number != 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
+		if( libesedb_page_get_from_pages_vector(
 		     database->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) database->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		     file_io_handle,
+		     database->page_tree->pages_cache,
+		     database->page_tree->io_handle,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -36,14 +36,19 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_sidecar.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
+ * With multi-thread support the tables, indexes and records of the file can be read
+ * from multiple threads, where every record and long value is used by a single thread
  * Returns 1 if successful or -1 on error
  */
 int libesedb_file_initialize(
@@ -131,6 +136,21 @@ int libesedb_file_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to intialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libesedb_file_t *) internal_file;
 
 	return( 1 );
@@ -194,6 +214,22 @@ int libesedb_file_free(
 		}
 		*file = NULL;
 
+		if( internal_file->sidecar_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->sidecar_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sidecar file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libesedb_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -207,6 +243,21 @@ int libesedb_file_free(
 
 			result = -1;
 		}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -265,6 +316,7 @@ int libesedb_file_open(
 	libesedb_internal_file_t *internal_file = NULL;
 	static char *function                   = "libesedb_file_open";
 	size_t filename_length                  = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -290,6 +342,17 @@ int libesedb_file_open(
 
 		return( -1 );
 	}
+	if( internal_file->memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory map already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( ( access_flags & LIBESEDB_ACCESS_FLAG_READ ) == 0 )
 	 && ( ( access_flags & LIBESEDB_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
@@ -360,6 +423,57 @@ int libesedb_file_open(
 
 		goto on_error;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( libesedb_memory_map_initialize(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		result = libesedb_memory_map_open(
+		          internal_file->memory_map,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The file cannot be memory mapped, fall back to reading using the file IO handle
+			 */
+			if( libesedb_memory_map_free(
+			     &( internal_file->memory_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -381,6 +495,12 @@ int libesedb_file_open(
 	return( 1 );
 
 on_error:
+	if( internal_file->memory_map != NULL )
+	{
+		libesedb_memory_map_free(
+		 &( internal_file->memory_map ),
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -630,6 +750,14 @@ int libesedb_file_open_file_io_handle(
 		}
 		internal_file->file_io_handle_opened_in_library = 1;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_NO_CHECKSUM_VERIFY ) != 0 )
+	{
+		internal_file->io_handle->skip_checksum_verification = 1;
+	}
+	else
+	{
+		internal_file->io_handle->skip_checksum_verification = 0;
+	}
 	if( libesedb_file_open_read(
 	     internal_file,
 	     file_io_handle,
@@ -753,6 +881,22 @@ int libesedb_file_close(
 	}
 	internal_file->file_io_handle = NULL;
 
+	if( internal_file->memory_map != NULL )
+	{
+		if( libesedb_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( libesedb_io_handle_clear(
 	     internal_file->io_handle,
 	     error ) != 1 )
@@ -831,6 +975,19 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	if( libesedb_sidecar_free(
+	     &( internal_file->sidecar ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sidecar.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
 }
 
@@ -846,6 +1003,9 @@ int libesedb_file_open_read(
 	static char *function               = "libesedb_file_open_read";
 	size64_t file_size                  = 0;
 	off64_t file_offset                 = 0;
+	uint64_t database_time              = 0;
+	uint32_t file_header_checksum       = 0;
+	int maximum_cache_entries           = 0;
 	int result                          = 0;
 	int segment_index                   = 0;
 
@@ -926,6 +1086,17 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->sidecar != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - sidecar already set.",
+		 function );
+
+		return( -1 );
+	}
 	internal_file->io_handle->abort = 0;
 
 	if( libbfio_handle_get_size(
@@ -983,6 +1154,9 @@ int libesedb_file_open_read(
 	internal_file->io_handle->creation_format_version  = file_header->creation_format_version;
 	internal_file->io_handle->creation_format_revision = file_header->creation_format_revision;
 
+	file_header_checksum = file_header->checksum;
+	database_time        = file_header->database_time;
+
 	if( libesedb_file_header_free(
 	     &file_header,
 	     error ) != 1 )
@@ -1255,9 +1429,23 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
+	if( libesedb_file_get_maximum_number_of_pages_cache_entries(
+	     internal_file,
+	     &maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of pages cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_initialize(
 	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     maximum_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1269,6 +1457,48 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
+	/* The pages cache is shared by the database, catalogs, tables, indexes and long values
+	 */
+	internal_file->io_handle->pages_cache = (libfdata_cache_t *) internal_file->pages_cache;
+	internal_file->io_handle->memory_map  = internal_file->memory_map;
+
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		if( libesedb_sidecar_initialize(
+		     &( internal_file->sidecar ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sidecar.",
+			 function );
+
+			goto on_error;
+		}
+		/* The sidecar is only used when it was written for this version of the file
+		 */
+		internal_file->sidecar->page_size            = internal_file->io_handle->page_size;
+		internal_file->sidecar->file_size            = file_size;
+		internal_file->sidecar->file_header_checksum = file_header_checksum;
+		internal_file->sidecar->database_time        = database_time;
+
+		if( libesedb_file_read_sidecar(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sidecar.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->sidecar = internal_file->sidecar;
+	}
 	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1388,6 +1618,11 @@ int libesedb_file_open_read(
 	}
 	internal_file->io_handle->abort = 0;
 
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	/* Items read from the file after this point are serialized using the read/write lock
+	 */
+	internal_file->io_handle->read_write_lock = internal_file->read_write_lock;
+#endif
 	return( 1 );
 
 on_error:
@@ -1421,27 +1656,39 @@ on_error:
 		 &( internal_file->pages_vector ),
 		 NULL );
 	}
+	if( internal_file->sidecar != NULL )
+	{
+		libesedb_sidecar_free(
+		 &( internal_file->sidecar ),
+		 NULL );
+	}
 	if( file_header != NULL )
 	{
 		libesedb_file_header_free(
 		 &file_header,
 		 NULL );
 	}
-	internal_file->io_handle->abort = 0;
+	internal_file->io_handle->pages_cache = NULL;
+	internal_file->io_handle->memory_map  = NULL;
+	internal_file->io_handle->sidecar     = NULL;
+	internal_file->io_handle->abort       = 0;
 
 	return( -1 );
 }
 
-/* Retrieves the file type
+/* Sets the filename of the sidecar cache file
+ * The filename must be set before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_type(
+int libesedb_file_set_sidecar_filename(
      libesedb_file_t *file,
-     uint32_t *type,
+     const char *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle        = NULL;
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_type";
+	static char *function                   = "libesedb_file_set_sidecar_filename";
+	size_t filename_length                  = 0;
 
 	if( file == NULL )
 	{
@@ -1456,44 +1703,104 @@ int libesedb_file_get_type(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( type == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	*type = internal_file->io_handle->file_type;
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in sidecar file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->sidecar_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sidecar file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->sidecar_file_io_handle = file_io_handle;
 
 	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file (current) version
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the sidecar cache file
+ * The filename must be set before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_format_version(
+int libesedb_file_set_sidecar_filename_wide(
      libesedb_file_t *file,
-     uint32_t *format_version,
-     uint32_t *format_revision,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle        = NULL;
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_format_version";
+	static char *function                   = "libesedb_file_set_sidecar_filename_wide";
+	size_t filename_length                  = 0;
 
 	if( file == NULL )
 	{
@@ -1508,56 +1815,1053 @@ int libesedb_file_get_format_version(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_revision == NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*format_version  = internal_file->io_handle->format_version;
-	*format_revision = internal_file->io_handle->format_revision;
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in sidecar file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->sidecar_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sidecar file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->sidecar_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the sidecar cache file
+ * A sidecar cache file that cannot be read or that does not match the file is ignored,
+ * the sidecar then remains empty and the catalog values are recorded in it while reading
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_read_sidecar(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_file_read_sidecar";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing sidecar file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_open(
+	          internal_file->sidecar_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libesedb_sidecar_read_file_io_handle(
+		          internal_file->sidecar,
+		          internal_file->sidecar_file_io_handle,
+		          error );
+
+		if( libbfio_handle_close(
+		     internal_file->sidecar_file_io_handle,
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		/* Discard the sidecar and start recording a new one
+		 */
+		if( libesedb_sidecar_clear_sections(
+		     internal_file->sidecar,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear sidecar sections.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the leaf page descriptors of a page tree to the sidecar
+ * Page trees that are already in the sidecar are not read again
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_append_page_tree_to_sidecar(
+     libesedb_internal_file_t *internal_file,
+     uint32_t object_identifier,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_t *page_tree = NULL;
+	const uint8_t *entries_data     = NULL;
+	static char *function           = "libesedb_file_append_page_tree_to_sidecar";
+	size_t entries_data_size        = 0;
+	uint32_t number_of_entries      = 0;
+	int result                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_sidecar_get_section(
+	          internal_file->sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	          root_page_number,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptors section: %" PRIu32 " from sidecar.",
+		 function,
+		 root_page_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_tree_initialize(
+	     &page_tree,
+	     internal_file->io_handle,
+	     internal_file->pages_vector,
+	     internal_file->pages_cache,
+	     object_identifier,
+	     root_page_number,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_append_leaf_page_descriptors_to_sidecar(
+	     page_tree,
+	     internal_file->file_io_handle,
+	     internal_file->sidecar,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append leaf page descriptors of page tree: %" PRIu32 " to sidecar.",
+		 function,
+		 root_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_free(
+	     &page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the leaf page descriptors of the tables, long values and indexes to the sidecar
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_append_page_trees_to_sidecar(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	static char *function                                   = "libesedb_file_append_page_trees_to_sidecar";
+	int index_catalog_definition_index                      = 0;
+	int number_of_index_catalog_definitions                 = 0;
+	int number_of_table_definitions                         = 0;
+	int table_definition_index                              = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->catalog == NULL )
+	{
+		return( 1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     internal_file->catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libesedb_catalog_get_table_definition_by_index(
+		     internal_file->catalog,
+		     table_definition_index,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( table_definition == NULL )
+		 || ( table_definition->table_catalog_definition == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( libesedb_file_append_page_tree_to_sidecar(
+		     internal_file,
+		     table_definition->table_catalog_definition->identifier,
+		     table_definition->table_catalog_definition->father_data_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table: %d page tree to sidecar.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( table_definition->long_value_catalog_definition != NULL )
+		{
+			if( libesedb_file_append_page_tree_to_sidecar(
+			     internal_file,
+			     table_definition->long_value_catalog_definition->identifier,
+			     table_definition->long_value_catalog_definition->father_data_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table: %d long values page tree to sidecar.",
+				 function,
+				 table_definition_index );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_table_definition_get_number_of_index_catalog_definitions(
+		     table_definition,
+		     &number_of_index_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of index catalog definitions of table: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		for( index_catalog_definition_index = 0;
+		     index_catalog_definition_index < number_of_index_catalog_definitions;
+		     index_catalog_definition_index++ )
+		{
+			if( libesedb_table_definition_get_index_catalog_definition_by_index(
+			     table_definition,
+			     index_catalog_definition_index,
+			     &index_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index catalog definition: %d of table: %d.",
+				 function,
+				 index_catalog_definition_index,
+				 table_definition_index );
+
+				return( -1 );
+			}
+			if( index_catalog_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing index catalog definition: %d of table: %d.",
+				 function,
+				 index_catalog_definition_index,
+				 table_definition_index );
+
+				return( -1 );
+			}
+			if( libesedb_file_append_page_tree_to_sidecar(
+			     internal_file,
+			     index_catalog_definition->identifier,
+			     index_catalog_definition->father_data_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index: %d of table: %d page tree to sidecar.",
+				 function,
+				 index_catalog_definition_index,
+				 table_definition_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the sidecar cache file
+ * All the leaf pages of the tables, long values and indexes are read to determine the leaf page descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_sidecar(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_sidecar";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing sidecar file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_append_page_trees_to_sidecar(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append page trees to sidecar.",
+		 function );
+
+		result = -1;
+	}
+	else if( libbfio_handle_open(
+	          internal_file->sidecar_file_io_handle,
+	          LIBBFIO_OPEN_WRITE_TRUNCATE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sidecar file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( libesedb_sidecar_write_file_io_handle(
+		     internal_file->sidecar,
+		     internal_file->sidecar_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sidecar.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_close(
+		     internal_file->sidecar_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close sidecar file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_type(
+     libesedb_file_t *file,
+     uint32_t *type,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	*type = internal_file->io_handle->file_type;
+
+	return( 1 );
+}
+
+/* Retrieves the file (current) version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_format_version(
+     libesedb_file_t *file,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version  = internal_file->io_handle->format_version;
+	*format_revision = internal_file->io_handle->format_revision;
+
+	return( 1 );
+}
+
+/* Retrieves the file creation format version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_creation_format_version(
+     libesedb_file_t *file,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_creation_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version  = internal_file->io_handle->creation_format_version;
+	*format_revision = internal_file->io_handle->creation_format_revision;
+
+	return( 1 );
+}
+
+/* Retrieves the file page size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_size(
+     libesedb_file_t *file,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_page_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+	*page_size = internal_file->io_handle->page_size;
 
 	return( 1 );
 }
 
-/* Retrieves the file creation format version
+/* Retrieves the maximum number of pages cache entries
+ * The number is determined by the pages cache size and the page size
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_creation_format_version(
+int libesedb_file_get_maximum_number_of_pages_cache_entries(
+     libesedb_internal_file_t *internal_file,
+     int *maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_file_get_maximum_number_of_pages_cache_entries";
+	size64_t number_of_cache_pages = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->pages_cache_size == 0 )
+	{
+		*maximum_cache_entries = LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES;
+
+		return( 1 );
+	}
+	number_of_cache_pages = internal_file->pages_cache_size / internal_file->io_handle->page_size;
+
+	/* Always cache at least a single page
+	 */
+	if( number_of_cache_pages == 0 )
+	{
+		number_of_cache_pages = 1;
+	}
+	else if( number_of_cache_pages > (size64_t) INT_MAX )
+	{
+		number_of_cache_pages = (size64_t) INT_MAX;
+	}
+	*maximum_cache_entries = (int) number_of_cache_pages;
+
+	return( 1 );
+}
+
+/* Sets the size of the pages cache in bytes
+ * The pages cache is shared by all the tables, indexes and long values of the file
+ * A size of 0 represents the default size
+ * The size can be set before or after the file has been opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_page_cache_size(
      libesedb_file_t *file,
-     uint32_t *format_version,
-     uint32_t *format_revision,
+     size64_t page_cache_size,
      libcerror_error_t **error )
 {
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_creation_format_version";
+	static char *function                   = "libesedb_file_set_page_cache_size";
+	int maximum_cache_entries               = 0;
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_grab_for_write(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->pages_cache_size = page_cache_size;
+
+	if( internal_file->pages_cache != NULL )
+	{
+		if( libesedb_file_get_maximum_number_of_pages_cache_entries(
+		     internal_file,
+		     &maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum number of pages cache entries.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfcache_cache_resize(
+		     internal_file->pages_cache,
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize pages cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the pages cache statistics
+ * A hit is a page that was retrieved from the pages cache, a miss a page that
+ * had to be read from the file. The statistics are reset when the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_page_cache_statistics";
 
 	if( file == NULL )
 	{
@@ -1583,44 +2887,64 @@ int libesedb_file_get_creation_format_version(
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( number_of_hits == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 "%s: invalid number of hits.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_revision == NULL )
+	if( number_of_misses == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 "%s: invalid number of misses.",
 		 function );
 
 		return( -1 );
 	}
-	*format_version  = internal_file->io_handle->creation_format_version;
-	*format_revision = internal_file->io_handle->creation_format_revision;
+	if( internal_file->io_handle->number_of_pages_cache_misses > internal_file->io_handle->number_of_pages_cache_lookups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - invalid IO handle - number of pages cache misses value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = internal_file->io_handle->number_of_pages_cache_lookups - internal_file->io_handle->number_of_pages_cache_misses;
+	*number_of_misses = internal_file->io_handle->number_of_pages_cache_misses;
 
 	return( 1 );
 }
 
-/* Retrieves the file page size
- * Returns 1 if successful or -1 on error
+/* Verifies the checksums of the pages in the file
+ * The pages are read one at a time without using the pages cache, hence with
+ * multi-thread support the verification can run in a separate thread while
+ * the file is being read. This allows to defer the verification of files
+ * opened with LIBESEDB_ACCESS_FLAG_NO_CHECKSUM_VERIFY
+ * Returns 1 if successful, 0 if aborted or -1 on error
  */
-int libesedb_file_get_page_size(
+int libesedb_file_verify_page_checksums(
      libesedb_file_t *file,
-     uint32_t *page_size,
+     uint32_t *number_of_mismatched_pages,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_page_size";
+	libesedb_internal_file_t *internal_file  = NULL;
+	libesedb_page_t *page                    = NULL;
+	static char *function                    = "libesedb_file_verify_page_checksums";
+	off64_t file_offset                      = 0;
+	uint32_t page_number                     = 0;
+	uint32_t safe_number_of_mismatched_pages = 0;
+	int result                               = 0;
 
 	if( file == NULL )
 	{
@@ -1646,20 +2970,147 @@ int libesedb_file_get_page_size(
 
 		return( -1 );
 	}
-	if( page_size == NULL )
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_mismatched_pages == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page size.",
+		 "%s: invalid number of mismatched pages.",
 		 function );
 
 		return( -1 );
 	}
-	*page_size = internal_file->io_handle->page_size;
+	for( page_number = 1;
+	     page_number <= internal_file->io_handle->last_page_number;
+	     page_number++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			*number_of_mismatched_pages = safe_number_of_mismatched_pages;
+
+			return( 0 );
+		}
+		file_offset = (off64_t) ( page_number + 1 ) * internal_file->io_handle->page_size;
+
+		if( libesedb_page_initialize(
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_io_handle_grab_for_write(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab IO handle for write.",
+			 function );
+
+			goto on_error;
+		}
+		result = libesedb_page_read_data_file_io_handle(
+		          page,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          error );
+
+		if( libesedb_io_handle_release_for_write(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release IO handle for write.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 " data.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		result = libesedb_page_verify_checksums(
+		          page,
+		          internal_file->io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page: %" PRIu32 " checksums.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			safe_number_of_mismatched_pages++;
+		}
+		if( libesedb_page_free(
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+	}
+	*number_of_mismatched_pages = safe_number_of_mismatched_pages;
 
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the number of tables
@@ -1831,6 +3282,8 @@ int libesedb_file_get_table(
 	     table,
 	     internal_file->file_io_handle,
 	     internal_file->io_handle,
+	     internal_file->pages_vector,
+	     internal_file->pages_cache,
 	     table_definition,
 	     template_table_definition,
 	     error ) != 1 )
@@ -1963,6 +3416,8 @@ int libesedb_file_get_table_by_utf8_name(
 		     table,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     table_definition,
 		     template_table_definition,
 		     error ) != 1 )
@@ -2096,6 +3551,8 @@ int libesedb_file_get_table_by_utf16_name(
 		     table,
 		     internal_file->file_io_handle,
 		     internal_file->io_handle,
+		     internal_file->pages_vector,
+		     internal_file->pages_cache,
 		     table_definition,
 		     template_table_definition,
 		     error ) != 1 )
@@ -31,8 +31,11 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_memory_map.h"
+#include "libesedb_sidecar.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,6 +61,10 @@ struct libesedb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory map
+	 */
+	libesedb_memory_map_t *memory_map;
+
 	/* The pages vector
 	 */
 	libfdata_vector_t *pages_vector;
@@ -66,6 +73,10 @@ struct libesedb_internal_file
 	 */
 	libfcache_cache_t *pages_cache;
 
+	/* The pages cache size in bytes
+	 */
+	size64_t pages_cache_size;
+
 	/* The database
 	 */
 	libesedb_database_t *database;
@@ -77,6 +88,20 @@ struct libesedb_internal_file
 	/* The backup catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* The sidecar cache file IO handle
+	 */
+	libbfio_handle_t *sidecar_file_io_handle;
+
+	/* The sidecar cache file
+	 */
+	libesedb_sidecar_t *sidecar;
+
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBESEDB_EXTERN \
@@ -129,6 +154,41 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_set_sidecar_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_sidecar_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif
+
+int libesedb_file_read_sidecar(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libesedb_file_append_page_tree_to_sidecar(
+     libesedb_internal_file_t *internal_file,
+     uint32_t object_identifier,
+     uint32_t root_page_number,
+     libcerror_error_t **error );
+
+int libesedb_file_append_page_trees_to_sidecar(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_write_sidecar(
+     libesedb_file_t *file,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_type(
      libesedb_file_t *file,
@@ -155,6 +215,30 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+int libesedb_file_get_maximum_number_of_pages_cache_entries(
+     libesedb_internal_file_t *internal_file,
+     int *maximum_cache_entries,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_page_cache_size(
+     libesedb_file_t *file,
+     size64_t page_cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_page_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_verify_page_checksums(
+     libesedb_file_t *file,
+     uint32_t *number_of_mismatched_pages,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
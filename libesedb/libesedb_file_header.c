@@ -256,6 +256,8 @@ int libesedb_file_header_read_data(
 
 		return( -1 );
 	}
+	file_header->checksum = stored_xor32_checksum;
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_file_header_t *) data )->format_version,
 	 file_header->format_version );
@@ -278,6 +280,10 @@ int libesedb_file_header_read_data(
 	 ( (esedb_file_header_t *) data )->creation_format_revision,
 	 file_header->creation_format_revision );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) data )->database_time,
+	 file_header->database_time );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -59,6 +59,14 @@ struct libesedb_file_header
 	/* The page size
 	 */
 	uint32_t page_size;
+
+	/* The (stored) checksum
+	 */
+	uint32_t checksum;
+
+	/* The database time
+	 */
+	uint64_t database_time;
 };
 
 int libesedb_file_header_initialize(
@@ -24,10 +24,14 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
+#include "libesedb_index_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
@@ -55,6 +59,8 @@ int libesedb_index_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_page_tree_t *table_page_tree,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_column_projection_t *column_projection,
+     libesedb_column_map_t *column_map,
      libcerror_error_t **error )
 {
 	libesedb_internal_index_t *internal_index = NULL;
@@ -168,6 +174,8 @@ int libesedb_index_initialize(
 	internal_index->long_values_pages_cache   = long_values_pages_cache;
 	internal_index->table_page_tree           = table_page_tree;
 	internal_index->long_values_page_tree     = long_values_page_tree;
+	internal_index->column_projection         = column_projection;
+	internal_index->column_map                = column_map;
 
 	*index = (libesedb_index_t *) internal_index;
 
@@ -210,8 +218,8 @@ int libesedb_index_free(
 		*index         = NULL;
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition,
-		 * index_catalog_definition, pages_vector, pages_cache, table_page_tree and
-		 * long_values_page_tree references are freed elsewhere
+		 * index_catalog_definition, pages_vector, pages_cache, table_page_tree,
+		 * long_values_page_tree, column_projection and column_map references are freed elsewhere
 		 */
 		if( libesedb_page_tree_free(
 		     &( internal_index->index_page_tree ),
@@ -493,6 +501,47 @@ int libesedb_index_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the number of key columns of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_number_of_key_columns(
+     libesedb_index_t *index,
+     int *number_of_key_columns,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_number_of_key_columns";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( libesedb_catalog_definition_get_number_of_key_columns(
+	     internal_index->index_catalog_definition,
+	     number_of_key_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of key columns.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of records in the index
  * Returns 1 if successful or -1 on error
  */
@@ -503,6 +552,7 @@ int libesedb_index_get_number_of_records(
 {
 	libesedb_internal_index_t *internal_index = NULL;
 	static char *function                     = "libesedb_index_get_number_of_records";
+	int result                                = 1;
 
 	if( index == NULL )
 	{
@@ -517,6 +567,19 @@ int libesedb_index_get_number_of_records(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_tree_get_number_of_leaf_values(
 	     internal_index->index_page_tree,
 	     internal_index->file_io_handle,
@@ -530,9 +593,22 @@ int libesedb_index_get_number_of_records(
 		 "%s: unable to retrieve number of leaf values from index page tree.",
 		 function );
 
+		result = -1;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves a specific record
@@ -544,13 +620,9 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *index_data_definition  = NULL;
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
-	libesedb_page_tree_key_t *key                      = NULL;
-	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
-	size_t index_data_size                             = 0;
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	static char *function                             = "libesedb_index_get_record";
 
 	if( index == NULL )
 	{
@@ -587,6 +659,19 @@ int libesedb_index_get_record(
 
 		return( -1 );
 	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_tree_get_leaf_value_by_index(
 	     internal_index->index_page_tree,
 	     internal_index->file_io_handle,
@@ -604,22 +689,19 @@ int libesedb_index_get_record(
 
 		goto on_error;
 	}
-	if( libesedb_data_definition_read_data(
+	if( libesedb_internal_index_get_record_by_data_definition(
+	     internal_index,
 	     index_data_definition,
-	     internal_index->file_io_handle,
-	     internal_index->io_handle,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
-	     &index_data,
-	     &index_data_size,
+	     record,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read index data definition data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_entry );
 
 		goto on_error;
 	}
@@ -634,111 +716,1157 @@ int libesedb_index_get_record(
 		 "%s: unable to free index data definition.",
 		 function );
 
+		libesedb_record_free(
+		 record,
+		 NULL );
+
 		goto on_error;
 	}
-	if( libesedb_page_tree_key_initialize(
-	     &key,
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
 		 function );
 
-		goto on_error;
+		libesedb_record_free(
+		 record,
+		 NULL );
+
+		return( -1 );
 	}
-	if( libesedb_page_tree_key_set_data(
-	     key,
-	     index_data,
-	     index_data_size,
+	return( 1 );
+
+on_error:
+	libesedb_io_handle_release_for_write(
+	 internal_index->io_handle,
+	 NULL );
+
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a batch of records
+ * The records of the index entries first_record_entry up to first_record_entry + number_of_records
+ * are stored in records, which must contain number_of_records entries set to NULL
+ * The table page tree is traversed in bookmark key order instead of index order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_records";
+	int result                                = 1;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set index data in key.",
+		 "%s: unable to grab IO handle for write.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
-
-	if( libesedb_page_tree_get_leaf_value_by_key(
-	     internal_index->table_page_tree,
-	     internal_index->file_io_handle,
-	     key,
-	     &record_data_definition,
+	if( libesedb_internal_index_get_records(
+	     internal_index,
+	     first_record_entry,
+	     number_of_records,
+	     records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value by key.",
+		 "%s: unable to retrieve records.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libesedb_page_tree_key_free(
-	     &key,
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free key.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libesedb_record_initialize(
-	     record,
+	return( result );
+}
+
+/* Retrieves the bookmark key of a specific index data definition
+ * The bookmark key is the key of the record in the table page tree
+ * This function does not grab the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_bookmark_key(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_page_tree_key_t **bookmark_key,
+     libcerror_error_t **error )
+{
+	uint8_t *index_data   = NULL;
+	static char *function = "libesedb_internal_index_get_bookmark_key";
+	size_t index_data_size = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bookmark key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bookmark_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bookmark key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
 	     internal_index->file_io_handle,
 	     internal_index->io_handle,
-	     internal_index->table_definition,
-	     internal_index->template_table_definition,
 	     internal_index->pages_vector,
 	     internal_index->pages_cache,
-	     internal_index->long_values_pages_vector,
-	     internal_index->long_values_pages_cache,
-	     record_data_definition,
-	     internal_index->long_values_page_tree,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_key_initialize(
+	     bookmark_key,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 "%s: unable to create bookmark key.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index data is copied since it references the cached page
+	 */
+	if( libesedb_page_tree_key_set_data(
+	     *bookmark_key,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index data in bookmark key.",
 		 function );
 
 		goto on_error;
 	}
+	( *bookmark_key )->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
 	return( 1 );
 
 on_error:
-	if( record_data_definition != NULL )
+	if( *bookmark_key != NULL )
 	{
-		libesedb_data_definition_free(
-		 &record_data_definition,
+		libesedb_page_tree_key_free(
+		 bookmark_key,
 		 NULL );
 	}
-	if( index_data_definition != NULL )
+	return( -1 );
+}
+
+/* Retrieves the record of a specific bookmark key
+ * This function does not grab the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_by_bookmark_key(
+     libesedb_internal_index_t *internal_index,
+     libesedb_page_tree_key_t *bookmark_key,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	static char *function                              = "libesedb_internal_index_get_record_by_bookmark_key";
+
+	if( internal_index == NULL )
 	{
-		libesedb_data_definition_free(
-		 &index_data_definition,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
 	}
-	if( key != NULL )
+	if( record == NULL )
 	{
-		libesedb_page_tree_key_free(
-		 &key,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_value_by_key(
+	     internal_index->table_page_tree,
+	     internal_index->file_io_handle,
+	     bookmark_key,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->long_values_pages_vector,
+	     internal_index->long_values_pages_cache,
+	     record_data_definition,
+	     internal_index->long_values_page_tree,
+	     internal_index->column_projection,
+	     NULL,
+	     internal_index->column_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record of a specific index data definition
+ * The index data definition contains the key of the record in the table page tree
+ * This function does not grab the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_by_data_definition(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *bookmark_key = NULL;
+	static char *function                  = "libesedb_internal_index_get_record_by_data_definition";
+
+	if( libesedb_internal_index_get_bookmark_key(
+	     internal_index,
+	     index_data_definition,
+	     &bookmark_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bookmark key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_internal_index_get_record_by_bookmark_key(
+	     internal_index,
+	     bookmark_key,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record by bookmark key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_key_free(
+	     &bookmark_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bookmark key.",
+		 function );
+
+		libesedb_record_free(
+		 record,
+		 NULL );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bookmark_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &bookmark_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two bookmark entries
+ * The bookmark entries are ordered by bookmark key and then by index entry,
+ * hence duplicate bookmark keys retain their index order
+ * Returns a value less than, equal to or greater than zero, as required by qsort
+ */
+int libesedb_index_bookmark_entry_compare(
+     const void *first_bookmark_entry,
+     const void *second_bookmark_entry )
+{
+	const libesedb_index_bookmark_entry_t *first_entry  = NULL;
+	const libesedb_index_bookmark_entry_t *second_entry = NULL;
+	int compare_result                                  = 0;
+
+	first_entry  = (const libesedb_index_bookmark_entry_t *) first_bookmark_entry;
+	second_entry = (const libesedb_index_bookmark_entry_t *) second_bookmark_entry;
+
+	/* The bookmark keys were validated when they were read, hence
+	 * the comparison cannot fail
+	 */
+	compare_result = libesedb_page_tree_key_compare_data(
+	                  second_entry->bookmark_key,
+	                  first_entry->bookmark_key->data,
+	                  first_entry->bookmark_key->data_size,
+	                  NULL );
+
+	if( compare_result == LIBFDATA_COMPARE_LESS )
+	{
+		return( -1 );
+	}
+	else if( compare_result == LIBFDATA_COMPARE_GREATER )
+	{
+		return( 1 );
+	}
+	if( first_entry->entry_index < second_entry->entry_index )
+	{
+		return( -1 );
+	}
+	else if( first_entry->entry_index > second_entry->entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a batch of records
+ * The bookmark keys of the index entries are sorted so that the records are
+ * retrieved from the table page tree in key order, which allows consecutive
+ * lookups to reuse the branch and leaf pages in the pages cache. The records
+ * are stored in records in index entry order.
+ * This function does not grab the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_index_bookmark_entry_t *bookmark_entries = NULL;
+	static char *function                             = "libesedb_internal_index_get_records";
+	int entry_index                                   = 0;
+	int sorted_entry_index                            = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records <= 0 )
+	 || ( (size_t) number_of_records > (size_t) ( SSIZE_MAX / sizeof( libesedb_index_bookmark_entry_t ) ) )
+	 || ( first_record_entry > ( INT_MAX - number_of_records ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_records;
+	     entry_index++ )
+	{
+		if( records[ entry_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid records - record: %d value already set.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	bookmark_entries = (libesedb_index_bookmark_entry_t *) memory_allocate(
+	                                                        sizeof( libesedb_index_bookmark_entry_t ) * number_of_records );
+
+	if( bookmark_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bookmark entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bookmark_entries,
+	     0,
+	     sizeof( libesedb_index_bookmark_entry_t ) * number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bookmark entries.",
+		 function );
+
+		memory_free(
+		 bookmark_entries );
+
+		bookmark_entries = NULL;
+
+		goto on_error;
+	}
+	/* Read the bookmark keys in index order
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_records;
+	     entry_index++ )
+	{
+		if( libesedb_page_tree_get_leaf_value_by_index(
+		     internal_index->index_page_tree,
+		     internal_index->file_io_handle,
+		     first_record_entry + entry_index,
+		     &index_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from index values tree.",
+			 function,
+			 first_record_entry + entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_internal_index_get_bookmark_key(
+		     internal_index,
+		     index_data_definition,
+		     &( bookmark_entries[ entry_index ].bookmark_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bookmark key: %d.",
+			 function,
+			 first_record_entry + entry_index );
+
+			goto on_error;
+		}
+		if( bookmark_entries[ entry_index ].bookmark_key == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing bookmark key: %d.",
+			 function,
+			 first_record_entry + entry_index );
+
+			goto on_error;
+		}
+		bookmark_entries[ entry_index ].entry_index = entry_index;
+
+		if( libesedb_data_definition_free(
+		     &index_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	qsort(
+	 bookmark_entries,
+	 (size_t) number_of_records,
+	 sizeof( libesedb_index_bookmark_entry_t ),
+	 &libesedb_index_bookmark_entry_compare );
+
+	/* Retrieve the records in bookmark key order
+	 */
+	for( sorted_entry_index = 0;
+	     sorted_entry_index < number_of_records;
+	     sorted_entry_index++ )
+	{
+		entry_index = bookmark_entries[ sorted_entry_index ].entry_index;
+
+		if( libesedb_internal_index_get_record_by_bookmark_key(
+		     internal_index,
+		     bookmark_entries[ sorted_entry_index ].bookmark_key,
+		     &( records[ entry_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 first_record_entry + entry_index );
+
+			goto on_error;
+		}
+	}
+	for( sorted_entry_index = 0;
+	     sorted_entry_index < number_of_records;
+	     sorted_entry_index++ )
+	{
+		if( libesedb_page_tree_key_free(
+		     &( bookmark_entries[ sorted_entry_index ].bookmark_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bookmark key: %d.",
+			 function,
+			 sorted_entry_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 bookmark_entries );
+
+	return( 1 );
+
+on_error:
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	if( bookmark_entries != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_records;
+		     entry_index++ )
+		{
+			if( bookmark_entries[ entry_index ].bookmark_key != NULL )
+			{
+				libesedb_page_tree_key_free(
+				 &( bookmark_entries[ entry_index ].bookmark_key ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 bookmark_entries );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_records;
+	     entry_index++ )
+	{
+		if( records[ entry_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ entry_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Seeks the index entries with a specific key
+ * The key data is the normalized key as stored in the index
+ * The index cursor is positioned at the first index entry with a key
+ * that is greater than or equal to the key data
+ * If seek_type is LIBESEDB_SEEK_TYPE_EQUAL the index cursor only returns
+ * the records of the index entries with a key equal to the key data
+ * If seek_type is LIBESEDB_SEEK_TYPE_PREFIX the index cursor only returns
+ * the records of the index entries with a key that starts with the key data
+ * If seek_type is LIBESEDB_SEEK_TYPE_GREATER_EQUAL the index cursor returns
+ * the records of all the remaining index entries
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int seek_type,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_seek";
+	uint8_t bound_type                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( seek_type )
+	{
+		case LIBESEDB_SEEK_TYPE_EQUAL:
+			bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE;
+			break;
+
+		case LIBESEDB_SEEK_TYPE_PREFIX:
+			bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_PREFIX;
+			break;
+
+		case LIBESEDB_SEEK_TYPE_GREATER_EQUAL:
+			bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported seek type.",
+			 function );
+
+			return( -1 );
+	}
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_cursor_initialize(
+	     index_cursor,
+	     internal_index,
+	     key_data,
+	     key_data_size,
+	     bound_type,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_internal_index_cursor_seek(
+	     (libesedb_internal_index_cursor_t *) *index_cursor,
+	     key_data,
+	     key_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to position index cursor.",
+		 function );
+
+		libesedb_io_handle_release_for_write(
+		 internal_index->io_handle,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_index_cursor_free(
+	 index_cursor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the index entries within a specific range of keys
+ * The start and stop key data are the normalized keys as stored in the index
+ * The start key is inclusive, the stop key is exclusive unless
+ * LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY is set
+ * Start key data of NULL represents the first index entry and
+ * stop key data of NULL the last index entry
+ * If LIBESEDB_RANGE_FLAG_BACKWARD is set the index cursor returns the records
+ * from the stop key to the start key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_range(
+     libesedb_index_t *index,
+     const uint8_t *start_key_data,
+     size_t start_key_data_size,
+     const uint8_t *stop_key_data,
+     size_t stop_key_data_size,
+     uint8_t range_flags,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	const uint8_t *bound_key_data             = NULL;
+	const uint8_t *seek_key_data              = NULL;
+	static char *function                     = "libesedb_index_get_range";
+	size_t bound_key_data_size                = 0;
+	size_t seek_key_data_size                 = 0;
+	uint8_t bound_type                        = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE;
+	uint8_t is_backward                       = 0;
+	uint8_t skip_equal                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( ( start_key_data != NULL )
+	 && ( ( start_key_data_size == 0 )
+	  ||  ( start_key_data_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stop_key_data != NULL )
+	 && ( ( stop_key_data_size == 0 )
+	  ||  ( stop_key_data_size > (size_t) SSIZE_MAX ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stop key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_flags & ~( LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY | LIBESEDB_RANGE_FLAG_BACKWARD ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported range flags: 0x%02" PRIx8 ".",
+		 function,
+		 range_flags );
+
+		return( -1 );
+	}
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* In forward order the index cursor is positioned at the start key and bound by the stop key,
+	 * in backward order it is positioned before the stop key and bound by the start key
+	 */
+	if( ( range_flags & LIBESEDB_RANGE_FLAG_BACKWARD ) == 0 )
+	{
+		if( stop_key_data != NULL )
+		{
+			bound_key_data      = stop_key_data;
+			bound_key_data_size = stop_key_data_size;
+
+			if( ( range_flags & LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY ) != 0 )
+			{
+				bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE;
+			}
+			else
+			{
+				bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_EXCLUSIVE;
+			}
+		}
+		seek_key_data      = start_key_data;
+		seek_key_data_size = start_key_data_size;
+	}
+	else
+	{
+		if( start_key_data != NULL )
+		{
+			bound_key_data      = start_key_data;
+			bound_key_data_size = start_key_data_size;
+			bound_type          = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE;
+		}
+		seek_key_data      = stop_key_data;
+		seek_key_data_size = stop_key_data_size;
+
+		if( ( range_flags & LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY ) != 0 )
+		{
+			skip_equal = 1;
+		}
+		is_backward = 1;
+	}
+	if( libesedb_index_cursor_initialize(
+	     index_cursor,
+	     internal_index,
+	     bound_key_data,
+	     bound_key_data_size,
+	     bound_type,
+	     is_backward,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_internal_index_cursor_seek(
+	     (libesedb_internal_index_cursor_t *) *index_cursor,
+	     seek_key_data,
+	     seek_key_data_size,
+	     skip_equal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to position index cursor.",
+		 function );
+
+		libesedb_io_handle_release_for_write(
+		 internal_index->io_handle,
 		 NULL );
+
+		goto on_error;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	libesedb_index_cursor_free(
+	 index_cursor,
+	 NULL );
+
 	return( -1 );
 }
 
+/* Creates a key to build a normalized key of the index
+ * The values of the key columns must be appended in the order of the key columns
+ * The resulting key data can be used to seek the index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_create_key(
+     libesedb_index_t *index,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_create_key";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_key_initialize(
+	     index_key,
+	     (libesedb_internal_index_t *) index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
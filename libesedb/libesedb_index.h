@@ -26,6 +26,9 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -33,6 +36,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -40,6 +44,19 @@
 extern "C" {
 #endif
 
+typedef struct libesedb_index_bookmark_entry libesedb_index_bookmark_entry_t;
+
+struct libesedb_index_bookmark_entry
+{
+	/* The bookmark key
+	 */
+	libesedb_page_tree_key_t *bookmark_key;
+
+	/* The index entry relative to the first entry of the batch
+	 */
+	int entry_index;
+};
+
 typedef struct libesedb_internal_index libesedb_internal_index_t;
 
 struct libesedb_internal_index
@@ -91,6 +108,16 @@ struct libesedb_internal_index
 	/* The index page tree
 	 */
 	libesedb_page_tree_t *index_page_tree;
+
+	/* The column projection
+	 * the column projection is shared with the table
+	 */
+	libesedb_column_projection_t *column_projection;
+
+	/* The column map
+	 * the column map is shared with the table
+	 */
+	libesedb_column_map_t *column_map;
 };
 
 int libesedb_index_initialize(
@@ -106,6 +133,8 @@ int libesedb_index_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_page_tree_t *table_page_tree,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_column_projection_t *column_projection,
+     libesedb_column_map_t *column_map,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -145,6 +174,12 @@ int libesedb_index_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_get_number_of_key_columns(
+     libesedb_index_t *index,
+     int *number_of_key_columns,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_number_of_records(
      libesedb_index_t *index,
@@ -158,6 +193,69 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_bookmark_key(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_page_tree_key_t **bookmark_key,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record_by_bookmark_key(
+     libesedb_internal_index_t *internal_index,
+     libesedb_page_tree_key_t *bookmark_key,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record_by_data_definition(
+     libesedb_internal_index_t *internal_index,
+     libesedb_data_definition_t *index_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_index_bookmark_entry_compare(
+     const void *first_bookmark_entry,
+     const void *second_bookmark_entry );
+
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int seek_type,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_range(
+     libesedb_index_t *index,
+     const uint8_t *start_key_data,
+     size_t start_key_data_size,
+     const uint8_t *stop_key_data,
+     size_t stop_key_data_size,
+     uint8_t range_flags,
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_create_key(
+     libesedb_index_t *index,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
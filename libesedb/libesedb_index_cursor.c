@@ -0,0 +1,1144 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
+#include "libesedb_index_key.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
+#include "libesedb_page_tree_value.h"
+#include "libesedb_page_value.h"
+#include "libesedb_record.h"
+#include "libesedb_types.h"
+
+/* Creates an index cursor
+ * Make sure the value index_cursor is referencing, is set to NULL
+ * The bound key data is the last key of the index entries in forward order
+ * or the first key of the index entries in backward order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_initialize(
+     libesedb_index_cursor_t **index_cursor,
+     libesedb_internal_index_t *internal_index,
+     const uint8_t *bound_key_data,
+     size_t bound_key_data_size,
+     uint8_t bound_type,
+     uint8_t is_backward,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_initialize";
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE )
+	 && ( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE )
+	 && ( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_EXCLUSIVE )
+	 && ( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_PREFIX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bound type.",
+		 function );
+
+		return( -1 );
+	}
+	if( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE )
+	{
+		if( bound_key_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid bound key data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( bound_key_data_size == 0 )
+		 || ( bound_key_data_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bound key data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_index_cursor = memory_allocate_structure(
+	                         libesedb_internal_index_cursor_t );
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal index cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_index_cursor,
+	     0,
+	     sizeof( libesedb_internal_index_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal index cursor.",
+		 function );
+
+		memory_free(
+		 internal_index_cursor );
+
+		return( -1 );
+	}
+	if( bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE )
+	{
+		internal_index_cursor->bound_key_data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * bound_key_data_size );
+
+		if( internal_index_cursor->bound_key_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create bound key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_index_cursor->bound_key_data,
+		     bound_key_data,
+		     bound_key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy bound key data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_index_cursor->bound_key_data_size = bound_key_data_size;
+	}
+	/* Use a separate cache for the current leaf page so that reading
+	 * the records does not evict it from the pages cache.
+	 */
+	if( libfcache_cache_initialize(
+	     &( internal_index_cursor->leaf_page_cache ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf page cache.",
+		 function );
+
+		goto on_error;
+	}
+	internal_index_cursor->internal_index = internal_index;
+	internal_index_cursor->bound_type     = bound_type;
+	internal_index_cursor->is_backward    = is_backward;
+
+	*index_cursor = (libesedb_index_cursor_t *) internal_index_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_index_cursor != NULL )
+	{
+		if( internal_index_cursor->bound_key_data != NULL )
+		{
+			memory_free(
+			 internal_index_cursor->bound_key_data );
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees an index cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_free(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	static char *function                                   = "libesedb_index_cursor_free";
+	int result                                              = 1;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_cursor != NULL )
+	{
+		internal_index_cursor = (libesedb_internal_index_cursor_t *) *index_cursor;
+		*index_cursor         = NULL;
+
+		/* The internal_index reference is freed elsewhere
+		 */
+		if( libfcache_cache_free(
+		     &( internal_index_cursor->leaf_page_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free leaf page cache.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_index_cursor->bound_key_data != NULL )
+		{
+			memory_free(
+			 internal_index_cursor->bound_key_data );
+		}
+		memory_free(
+		 internal_index_cursor );
+	}
+	return( result );
+}
+
+/* Positions the index cursor at the first index entry with a key that is greater than or equal to specific key data
+ * If skip_equal is set the index cursor is positioned at the first index entry with a key that is greater than the key data
+ * In backward order the index cursor is positioned at the index entry before it
+ * Key data of NULL positions the index cursor at the first index entry in forward order
+ * or at the last index entry in backward order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_cursor_seek(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_internal_index_cursor_seek";
+	uint32_t leaf_page_number                 = 0;
+	uint16_t page_value_index                 = 0;
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( ( key_data == NULL )
+	 && ( internal_index_cursor->is_backward == 0 ) )
+	{
+		if( libesedb_page_tree_get_get_first_leaf_page_number(
+		     internal_index->index_page_tree,
+		     internal_index->file_io_handle,
+		     &leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number from index page tree.",
+			 function );
+
+			return( -1 );
+		}
+		page_value_index = 1;
+	}
+	else if( libesedb_page_tree_get_leaf_page_value_index_by_key_data(
+	          internal_index->index_page_tree,
+	          internal_index->file_io_handle,
+	          internal_index_cursor->leaf_page_cache,
+	          key_data,
+	          key_data_size,
+	          skip_equal,
+	          &leaf_page_number,
+	          &page_value_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page value index by key data from index page tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor->leaf_page_number = leaf_page_number;
+	internal_index_cursor->page_value_index = (int) page_value_index;
+
+	if( internal_index_cursor->is_backward != 0 )
+	{
+		internal_index_cursor->page_value_index -= 1;
+	}
+	return( 1 );
+}
+
+/* Determines if a key is within the bound of the index cursor
+ * Returns 1 if within the bound, 0 if not or -1 on error
+ */
+int libesedb_internal_index_cursor_is_within_bound(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libesedb_page_tree_key_t *key,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_index_cursor_is_within_bound";
+	int compare_result    = 0;
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->bound_type == LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE )
+	{
+		return( 1 );
+	}
+	if( internal_index_cursor->bound_type == LIBESEDB_INDEX_CURSOR_BOUND_TYPE_PREFIX )
+	{
+		if( key->data_size < internal_index_cursor->bound_key_data_size )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     key->data,
+		     internal_index_cursor->bound_key_data,
+		     internal_index_cursor->bound_key_data_size ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	compare_result = libesedb_page_tree_key_compare_data(
+	                  key,
+	                  internal_index_cursor->bound_key_data,
+	                  internal_index_cursor->bound_key_data_size,
+	                  error );
+
+	if( compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare bound key data with key.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == LIBFDATA_COMPARE_EQUAL )
+	{
+		if( internal_index_cursor->bound_type == LIBESEDB_INDEX_CURSOR_BOUND_TYPE_EXCLUSIVE )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	/* In forward order the bound key data is the upper bound
+	 * and in backward order the lower bound
+	 */
+	if( internal_index_cursor->is_backward == 0 )
+	{
+		if( compare_result == LIBFDATA_COMPARE_LESS )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the next record
+ * The index entries are read in the order of the index cursor, where the leaf pages
+ * are read in order of their next or previous page number
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_index_cursor_get_next_record(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_internal_index_t *internal_index               = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_next_record";
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          internal_index_cursor,
+	          record,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next record.",
+		 function );
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		if( result == 1 )
+		{
+			libesedb_record_free(
+			 record,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the index key of the next index entry
+ * This provides an index-only scan where the record is not read from the table
+ * Returns 1 if successful, 0 if no more index entries are available or -1 on error
+ */
+int libesedb_index_cursor_get_next_key(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libesedb_internal_index_t *internal_index               = NULL;
+	static char *function                                   = "libesedb_index_cursor_get_next_key";
+	int result                                              = 0;
+
+	if( index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          internal_index_cursor,
+	          NULL,
+	          index_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next index key.",
+		 function );
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_index->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		if( result == 1 )
+		{
+			libesedb_index_key_free(
+			 index_key,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next index entry as either a record or an index key
+ * The index key is retrieved from the index entry only, without reading the record from the table
+ * The index entries are read in the order of the index cursor, where the leaf pages
+ * are read in order of their next or previous page number
+ * Returns 1 if successful, 0 if no more index entries are available or -1 on error
+ */
+int libesedb_internal_index_cursor_get_next_entry(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libesedb_record_t **record,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	libesedb_page_t *leaf_page                        = NULL;
+	libesedb_page_tree_key_t *key                     = NULL;
+	libesedb_page_tree_value_t *page_tree_value       = NULL;
+	libesedb_page_value_t *page_value                 = NULL;
+	static char *function                             = "libesedb_internal_index_cursor_get_next_entry";
+	uint32_t next_leaf_page_number                    = 0;
+	uint32_t page_flags                               = 0;
+	uint16_t number_of_page_values                    = 0;
+	uint16_t page_value_index                         = 0;
+	int result                                        = 0;
+
+	if( internal_index_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_cursor->internal_index;
+
+	if( ( record == NULL )
+	 && ( index_key == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record and index key.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_index_cursor->leaf_page_number != 0 )
+	{
+#if ( SIZEOF_INT <= 4 )
+		if( ( internal_index_cursor->leaf_page_number > internal_index->io_handle->last_page_number )
+		 || ( internal_index_cursor->leaf_page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( internal_index_cursor->leaf_page_number > internal_index->io_handle->last_page_number )
+		 || ( (int) internal_index_cursor->leaf_page_number > INT_MAX ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The leaf page remains in the leaf page cache until the cursor moves to the next leaf page
+		 */
+		if( libesedb_page_get_from_pages_vector(
+		     internal_index->pages_vector,
+		     internal_index->file_io_handle,
+		     internal_index_cursor->leaf_page_cache,
+		     internal_index->io_handle,
+		     internal_index_cursor->leaf_page_number,
+		     &leaf_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_index_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_flags(
+		     leaf_page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+			 function,
+			 internal_index_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     leaf_page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_index_cursor->page_value_index == -1 )
+		{
+			internal_index_cursor->page_value_index = (int) number_of_page_values - 1;
+		}
+		while( ( internal_index_cursor->page_value_index >= 1 )
+		    && ( internal_index_cursor->page_value_index < (int) number_of_page_values ) )
+		{
+			page_value_index = (uint16_t) internal_index_cursor->page_value_index;
+
+			if( internal_index_cursor->is_backward == 0 )
+			{
+				internal_index_cursor->page_value_index += 1;
+			}
+			else
+			{
+				internal_index_cursor->page_value_index -= 1;
+			}
+			if( ( internal_index_cursor->bound_type != LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE )
+			 || ( index_key != NULL ) )
+			{
+				result = libesedb_page_tree_get_key_of_page_value(
+				          internal_index->index_page_tree,
+				          leaf_page,
+				          page_flags,
+				          page_value_index,
+				          &page_value,
+				          &page_tree_value,
+				          &key,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key of page value: %" PRIu16 " from page: %" PRIu32 ".",
+					 function,
+					 page_value_index,
+					 internal_index_cursor->leaf_page_number );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					continue;
+				}
+				result = libesedb_internal_index_cursor_is_within_bound(
+				          internal_index_cursor,
+				          key,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if key of page value: %" PRIu16 " is within bound.",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( ( result != 0 )
+				 && ( index_key != NULL ) )
+				{
+					if( libesedb_index_key_initialize(
+					     index_key,
+					     internal_index,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create index key.",
+						 function );
+
+						goto on_error;
+					}
+					if( libesedb_internal_index_key_set_data(
+					     (libesedb_internal_index_key_t *) *index_key,
+					     key->data,
+					     key->data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set index key data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libesedb_page_tree_key_free(
+				     &key,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free key.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_page_tree_value_free(
+				     &page_tree_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page tree value.",
+					 function );
+
+					goto on_error;
+				}
+				/* The index entries are ordered by key, hence no other index entries are within the bound
+				 */
+				if( result == 0 )
+				{
+					internal_index_cursor->leaf_page_number = 0;
+
+					return( 0 );
+				}
+				/* An index-only scan does not read the record from the table
+				 */
+				if( index_key != NULL )
+				{
+					return( 1 );
+				}
+			}
+			result = libesedb_page_tree_get_leaf_value_from_leaf_page(
+			          internal_index->index_page_tree,
+			          leaf_page,
+			          page_value_index,
+			          &index_data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+				 function,
+				 page_value_index,
+				 internal_index_cursor->leaf_page_number );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( libesedb_internal_index_get_record_by_data_definition(
+			     internal_index,
+			     index_data_definition,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record of leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+				 function,
+				 page_value_index,
+				 internal_index_cursor->leaf_page_number );
+
+				goto on_error;
+			}
+			if( libesedb_data_definition_free(
+			     &index_data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index data definition.",
+				 function );
+
+				libesedb_record_free(
+				 record,
+				 NULL );
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+		if( internal_index_cursor->is_backward == 0 )
+		{
+			result = libesedb_page_get_next_page_number(
+			          leaf_page,
+			          &next_leaf_page_number,
+			          error );
+		}
+		else
+		{
+			result = libesedb_page_get_previous_page_number(
+			          leaf_page,
+			          &next_leaf_page_number,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 internal_index_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( next_leaf_page_number == internal_index_cursor->leaf_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next page number: %" PRIu32 " - self reference.",
+			 function,
+			 next_leaf_page_number );
+
+			goto on_error;
+		}
+		internal_index_cursor->leaf_page_number = next_leaf_page_number;
+
+		if( internal_index_cursor->is_backward == 0 )
+		{
+			internal_index_cursor->page_value_index = 1;
+		}
+		else
+		{
+			internal_index_cursor->page_value_index = -1;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( ( index_key != NULL )
+	 && ( *index_key != NULL ) )
+	{
+		libesedb_index_key_free(
+		 index_key,
+		 NULL );
+	}
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INDEX_CURSOR_H )
+#define _LIBESEDB_INDEX_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_extern.h"
+#include "libesedb_index.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_page_tree_key.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_index_cursor libesedb_internal_index_cursor_t;
+
+struct libesedb_internal_index_cursor
+{
+	/* The index
+	 */
+	libesedb_internal_index_t *internal_index;
+
+	/* The leaf page cache
+	 */
+	libfcache_cache_t *leaf_page_cache;
+
+	/* The current leaf page number
+	 */
+	uint32_t leaf_page_number;
+
+	/* The next page value index in the current leaf page
+	 * where -1 represents the last page value of the leaf page
+	 */
+	int page_value_index;
+
+	/* The bound key data
+	 */
+	uint8_t *bound_key_data;
+
+	/* The bound key data size
+	 */
+	size_t bound_key_data_size;
+
+	/* The bound type
+	 */
+	uint8_t bound_type;
+
+	/* Value to indicate the index entries are read in reverse order
+	 */
+	uint8_t is_backward;
+};
+
+int libesedb_index_cursor_initialize(
+     libesedb_index_cursor_t **index_cursor,
+     libesedb_internal_index_t *internal_index,
+     const uint8_t *bound_key_data,
+     size_t bound_key_data_size,
+     uint8_t bound_type,
+     uint8_t is_backward,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_free(
+     libesedb_index_cursor_t **index_cursor,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_cursor_seek(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_cursor_is_within_bound(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libesedb_page_tree_key_t *key,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_next_record(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_get_next_key(
+     libesedb_index_cursor_t *index_cursor,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_cursor_get_next_entry(
+     libesedb_internal_index_cursor_t *internal_index_cursor,
+     libesedb_record_t **record,
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INDEX_CURSOR_H ) */
+
@@ -0,0 +1,2974 @@
+/*
+ * Index key functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_map.h"
+#include "libesedb_definitions.h"
+#include "libesedb_index.h"
+#include "libesedb_index_key.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+#include "libesedb_types.h"
+
+/* The order in which the GUID bytes are stored in a normalized key
+ */
+const uint8_t libesedb_index_key_guid_byte_order[ 16 ] = {
+	10, 11, 12, 13, 14, 15, 8, 9, 6, 7, 4, 5, 0, 1, 2, 3 };
+
+/* The order in which the GUID bytes are stored in a normalized key of an index with .NET GUID sort order
+ */
+const uint8_t libesedb_index_key_dot_net_guid_byte_order[ 16 ] = {
+	3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+/* Creates an index key
+ * Make sure the value index_key is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_initialize(
+     libesedb_index_key_t **index_key,
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_initialize";
+	int number_of_key_columns                         = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_number_of_key_columns(
+	     internal_index->index_catalog_definition,
+	     &number_of_key_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of key columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = memory_allocate_structure(
+	                      libesedb_internal_index_key_t );
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal index key.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_index_key,
+	     0,
+	     sizeof( libesedb_internal_index_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal index key.",
+		 function );
+
+		memory_free(
+		 internal_index_key );
+
+		return( -1 );
+	}
+	/* The key most value of the index catalog definition overrides
+	 * the default maximum size of a normalized key
+	 */
+	if( internal_index->index_catalog_definition->key_most != 0 )
+	{
+		internal_index_key->maximum_data_size = (size_t) internal_index->index_catalog_definition->key_most;
+	}
+	else
+	{
+		internal_index_key->maximum_data_size = LIBESEDB_DEFAULT_MAXIMUM_KEY_SIZE;
+	}
+	internal_index_key->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * internal_index_key->maximum_data_size );
+
+	if( internal_index_key->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_index_key->internal_index        = internal_index;
+	internal_index_key->number_of_key_columns = number_of_key_columns;
+
+	*index_key = (libesedb_index_key_t *) internal_index_key;
+
+	return( 1 );
+
+on_error:
+	if( internal_index_key != NULL )
+	{
+		memory_free(
+		 internal_index_key );
+	}
+	return( -1 );
+}
+
+/* Frees an index key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_free(
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_free";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_key != NULL )
+	{
+		internal_index_key = (libesedb_internal_index_key_t *) *index_key;
+		*index_key         = NULL;
+
+		/* The internal_index reference is freed elsewhere
+		 */
+		if( internal_index_key->data != NULL )
+		{
+			memory_free(
+			 internal_index_key->data );
+		}
+		memory_free(
+		 internal_index_key );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column catalog definition and key column flags of a specific key column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_key_get_key_column(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *key_column_flags,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_internal_index_key_get_key_column";
+	uint32_t column_identifier                = 0;
+	int result                                = 0;
+	int value_entry                           = 0;
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index key - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_index_key->internal_index;
+
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_column_index < 0 )
+	 || ( key_column_index >= internal_index_key->number_of_key_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_key_column(
+	     internal_index->index_catalog_definition,
+	     key_column_index,
+	     &column_identifier,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          internal_index->column_map,
+	          column_identifier,
+	          &value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry from column map.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_identifier,
+		 key_column_index );
+
+		return( -1 );
+	}
+	*column_catalog_definition = internal_index->column_map->entries[ value_entry ].column_catalog_definition;
+
+	return( 1 );
+}
+
+/* Appends the data of a normalized key segment
+ * The segment data, including the prefix, is complemented if the key column is descending
+ * Segment data that does not fit in the maximum key size is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_key_append_segment_data(
+     libesedb_internal_index_key_t *internal_index_key,
+     const uint8_t *segment_data,
+     size_t segment_data_size,
+     uint8_t key_column_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_internal_index_key_append_segment_data";
+	size_t copy_size          = 0;
+	size_t segment_data_index = 0;
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->data_size > internal_index_key->maximum_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index key - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	copy_size = internal_index_key->maximum_data_size - internal_index_key->data_size;
+
+	if( segment_data_size > copy_size )
+	{
+		internal_index_key->is_truncated = 1;
+	}
+	else
+	{
+		copy_size = segment_data_size;
+	}
+	for( segment_data_index = 0;
+	     segment_data_index < copy_size;
+	     segment_data_index++ )
+	{
+		if( ( key_column_flags & LIBESEDB_KEY_COLUMN_FLAG_IS_DESCENDING ) != 0 )
+		{
+			internal_index_key->data[ internal_index_key->data_size++ ] = ~( segment_data[ segment_data_index ] );
+		}
+		else
+		{
+			internal_index_key->data[ internal_index_key->data_size++ ] = segment_data[ segment_data_index ];
+		}
+	}
+	internal_index_key->key_column_index += 1;
+
+	return( 1 );
+}
+
+/* Appends a fixed size value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_key_append_fixed_size_value(
+     libesedb_internal_index_key_t *internal_index_key,
+     uint64_t value_64bit,
+     size_t value_size,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 9 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_internal_index_key_append_fixed_size_value";
+	size_t column_value_size                                 = 0;
+	size_t segment_data_index                                = 0;
+	uint64_t sign_bit                                        = 0;
+	uint8_t column_value_type                                = 0;
+	uint8_t is_signed                                        = 0;
+	uint8_t key_column_flags                                 = 0;
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_get_key_column(
+	     internal_index_key,
+	     internal_index_key->key_column_index,
+	     &column_catalog_definition,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_BOOLEAN;
+			column_value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 2;
+			is_signed         = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 4;
+			is_signed         = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER;
+			column_value_size = 8;
+			is_signed         = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT;
+			column_value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT;
+			column_value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			column_value_type = LIBESEDB_INDEX_KEY_VALUE_TYPE_FILETIME;
+			column_value_size = 8;
+			break;
+
+		default:
+			break;
+	}
+	if( ( column_value_type != value_type )
+	 || ( column_value_size != value_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value for column type: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->column_type,
+		 internal_index_key->key_column_index );
+
+		return( -1 );
+	}
+	sign_bit = (uint64_t) 1 << ( ( value_size * 8 ) - 1 );
+
+	if( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_BOOLEAN )
+	{
+		if( value_64bit != 0 )
+		{
+			value_64bit = 0xff;
+		}
+	}
+	else if( is_signed != 0 )
+	{
+		value_64bit ^= sign_bit;
+	}
+	else if( value_type != LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER )
+	{
+		/* Floating-point and date and time values are stored as IEEE 754 values
+		 * positive values have their sign bit set and negative values are complemented
+		 */
+		if( ( value_64bit & sign_bit ) == 0 )
+		{
+			value_64bit ^= sign_bit;
+		}
+		else
+		{
+			value_64bit = ~value_64bit;
+		}
+	}
+	segment_data[ 0 ] = LIBESEDB_KEY_SEGMENT_PREFIX_DATA;
+
+	for( segment_data_index = value_size;
+	     segment_data_index > 0;
+	     segment_data_index-- )
+	{
+		segment_data[ segment_data_index ] = (uint8_t) ( value_64bit & 0xff );
+
+		value_64bit >>= 8;
+	}
+	if( libesedb_internal_index_key_append_segment_data(
+	     internal_index_key,
+	     segment_data,
+	     value_size + 1,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the normalized key data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_get_data_size(
+     libesedb_index_key_t *index_key,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_get_data_size";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_index_key->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the normalized key data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_get_data(
+     libesedb_index_key_t *index_key,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_get_data";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < internal_index_key->data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->data_size > 0 )
+	{
+		if( memory_copy(
+		     data,
+		     internal_index_key->data,
+		     internal_index_key->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the normalized key data was truncated to the maximum key size
+ * Returns 1 if truncated, 0 if not or -1 on error
+ */
+int libesedb_index_key_is_truncated(
+     libesedb_index_key_t *index_key,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_is_truncated";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	return( (int) internal_index_key->is_truncated );
+}
+
+/* Appends a NULL value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_null(
+     libesedb_index_key_t *index_key,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_index_key_t *internal_index_key        = NULL;
+	static char *function                                    = "libesedb_index_key_append_null";
+	uint8_t key_column_flags                                 = 0;
+	uint8_t segment_prefix                                   = LIBESEDB_KEY_SEGMENT_PREFIX_NULL;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( libesedb_internal_index_key_get_key_column(
+	     internal_index_key,
+	     internal_index_key->key_column_index,
+	     &column_catalog_definition,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_index_key->internal_index->index_catalog_definition->flags & LIBESEDB_INDEX_FLAG_SORT_NULLS_HIGH ) != 0 )
+	{
+		segment_prefix = LIBESEDB_KEY_SEGMENT_PREFIX_NULL_HIGH;
+	}
+	if( libesedb_internal_index_key_append_segment_data(
+	     internal_index_key,
+	     &segment_prefix,
+	     1,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a boolean value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_boolean(
+     libesedb_index_key_t *index_key,
+     uint8_t value_boolean,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_boolean";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_boolean,
+	     1,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_BOOLEAN,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append boolean value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an 8-bit value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_8bit(
+     libesedb_index_key_t *index_key,
+     uint8_t value_8bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_8bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_8bit,
+	     1,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 8-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 16-bit value segment
+ * The value is interpreted as signed if the column type is signed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_16bit(
+     libesedb_index_key_t *index_key,
+     uint16_t value_16bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_16bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_16bit,
+	     2,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 16-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 32-bit value segment
+ * The value is interpreted as signed if the column type is signed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_32bit(
+     libesedb_index_key_t *index_key,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_32bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_32bit,
+	     4,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit value segment
+ * The value is interpreted as signed if the column type is signed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_64bit(
+     libesedb_index_key_t *index_key,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_64bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_64bit,
+	     8,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit FILETIME value segment
+ * The value is the 64-bit value as returned by libesedb_record_get_value_filetime
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_filetime(
+     libesedb_index_key_t *index_key,
+     uint64_t value_filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_append_filetime";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     value_filetime,
+	     8,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_FILETIME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append FILETIME value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 32-bit floating-point value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_floating_point_32bit(
+     libesedb_index_key_t *index_key,
+     float value_floating_point_32bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t value_float32;
+
+	static char *function = "libesedb_index_key_append_floating_point_32bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	value_float32.floating_point = value_floating_point_32bit;
+
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_float32.integer,
+	     4,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 32-bit floating-point value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit floating-point value segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_floating_point_64bit(
+     libesedb_index_key_t *index_key,
+     double value_floating_point_64bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t value_float64;
+
+	static char *function = "libesedb_index_key_append_floating_point_64bit";
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	value_float64.floating_point = value_floating_point_64bit;
+
+	if( libesedb_internal_index_key_append_fixed_size_value(
+	     (libesedb_internal_index_key_t *) index_key,
+	     (uint64_t) value_float64.integer,
+	     8,
+	     LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append 64-bit floating-point value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a GUID value segment
+ * The GUID data is expected to be stored in little-endian as in the record value data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_guid(
+     libesedb_index_key_t *index_key,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 17 ];
+
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_index_key_t *internal_index_key        = NULL;
+	static char *function                                    = "libesedb_index_key_append_guid";
+	const uint8_t *guid_byte_order                           = NULL;
+	uint8_t guid_byte_index                                  = 0;
+	uint8_t key_column_flags                                 = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported GUID data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_get_key_column(
+	     internal_index_key,
+	     internal_index_key->key_column_index,
+	     &column_catalog_definition,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_GUID )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value for column type: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->column_type,
+		 internal_index_key->key_column_index );
+
+		return( -1 );
+	}
+	if( ( internal_index_key->internal_index->index_catalog_definition->flags & LIBESEDB_INDEX_FLAG_DOT_NET_GUID ) != 0 )
+	{
+		guid_byte_order = libesedb_index_key_dot_net_guid_byte_order;
+	}
+	else
+	{
+		guid_byte_order = libesedb_index_key_guid_byte_order;
+	}
+	segment_data[ 0 ] = LIBESEDB_KEY_SEGMENT_PREFIX_DATA;
+
+	for( guid_byte_index = 0;
+	     guid_byte_index < 16;
+	     guid_byte_index++ )
+	{
+		segment_data[ guid_byte_index + 1 ] = guid_data[ guid_byte_order[ guid_byte_index ] ];
+	}
+	if( libesedb_internal_index_key_append_segment_data(
+	     internal_index_key,
+	     segment_data,
+	     17,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-8 encoded string value segment
+ * The string is converted to the codepage of the column, upper cased and terminated by 0
+ * Text columns that use Unicode (codepage 1200) are currently not supported
+ * since their normalized form depends on the Windows LCMapString sort key
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_utf8_string(
+     libesedb_index_key_t *index_key,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_index_key_t *internal_index_key        = NULL;
+	uint8_t *segment_data                                    = NULL;
+	static char *function                                    = "libesedb_index_key_append_utf8_string";
+	size_t byte_stream_size                                  = 0;
+	size_t segment_data_index                                = 0;
+	size_t segment_data_size                                 = 0;
+	uint8_t key_column_flags                                 = 0;
+	uint8_t segment_prefix                                   = LIBESEDB_KEY_SEGMENT_PREFIX_ZERO_LENGTH;
+	int codepage                                             = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_get_key_column(
+	     internal_index_key,
+	     internal_index_key->key_column_index,
+	     &column_catalog_definition,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_TEXT )
+	 && ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value for column type: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->column_type,
+		 internal_index_key->key_column_index );
+
+		goto on_error;
+	}
+	codepage = (int) column_catalog_definition->codepage;
+
+	/* If the codepage is not set use the default codepage
+	 */
+	if( codepage == 0 )
+	{
+		codepage = internal_index_key->internal_index->io_handle->ascii_codepage;
+	}
+	if( codepage == 1200 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported Unicode text column: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->identifier,
+		 internal_index_key->key_column_index );
+
+		goto on_error;
+	}
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ 0 ] != 0 ) )
+	{
+		if( libuna_byte_stream_size_from_utf8(
+		     utf8_string,
+		     utf8_string_length,
+		     codepage,
+		     &byte_stream_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine byte stream size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( byte_stream_size == 0 )
+	{
+		segment_data      = &segment_prefix;
+		segment_data_size = 1;
+	}
+	else
+	{
+		/* The segment data consists of the prefix, the byte stream and the end-of-string character
+		 */
+		segment_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * ( byte_stream_size + 2 ) );
+
+		if( segment_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_byte_stream_copy_from_utf8(
+		     &( segment_data[ 1 ] ),
+		     byte_stream_size,
+		     codepage,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream.",
+			 function );
+
+			goto on_error;
+		}
+		segment_data[ 0 ] = LIBESEDB_KEY_SEGMENT_PREFIX_DATA;
+
+		for( segment_data_index = 1;
+		     segment_data_index <= byte_stream_size;
+		     segment_data_index++ )
+		{
+			if( segment_data[ segment_data_index ] == 0 )
+			{
+				break;
+			}
+			if( ( segment_data[ segment_data_index ] >= (uint8_t) 'a' )
+			 && ( segment_data[ segment_data_index ] <= (uint8_t) 'z' ) )
+			{
+				segment_data[ segment_data_index ] -= (uint8_t) ( 'a' - 'A' );
+			}
+		}
+		segment_data[ segment_data_index ] = 0;
+
+		segment_data_size = segment_data_index + 1;
+	}
+	if( libesedb_internal_index_key_append_segment_data(
+	     internal_index_key,
+	     segment_data,
+	     segment_data_size,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment data.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_data != &segment_prefix )
+	{
+		memory_free(
+		 segment_data );
+	}
+	return( 1 );
+
+on_error:
+	if( ( segment_data != NULL )
+	 && ( segment_data != &segment_prefix ) )
+	{
+		memory_free(
+		 segment_data );
+	}
+	return( -1 );
+}
+
+/* Appends a binary data value segment
+ * The binary data of a variable size column is stored in chunks of 8 bytes
+ * where every chunk is followed by a byte that indicates the number of bytes in the chunk
+ * or 9 if more chunks follow
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_append_binary_data(
+     libesedb_index_key_t *index_key,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_index_key_t *internal_index_key        = NULL;
+	uint8_t *segment_data                                    = NULL;
+	static char *function                                    = "libesedb_index_key_append_binary_data";
+	size_t binary_data_offset                                = 0;
+	size_t chunk_size                                        = 0;
+	size_t segment_data_offset                               = 0;
+	size_t segment_data_size                                 = 0;
+	uint8_t key_column_flags                                 = 0;
+	uint8_t segment_prefix                                   = LIBESEDB_KEY_SEGMENT_PREFIX_ZERO_LENGTH;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( ( binary_data == NULL )
+	 && ( binary_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) ( ( SSIZE_MAX / 9 ) * 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_key_get_key_column(
+	     internal_index_key,
+	     internal_index_key->key_column_index,
+	     &column_catalog_definition,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	 && ( column_catalog_definition->column_type != LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value for column type: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->column_type,
+		 internal_index_key->key_column_index );
+
+		goto on_error;
+	}
+	if( binary_data_size == 0 )
+	{
+		segment_data      = &segment_prefix;
+		segment_data_size = 1;
+	}
+	else
+	{
+		/* The binary data of a fixed size column is stored as-is
+		 */
+		if( column_catalog_definition->identifier <= 127 )
+		{
+			segment_data_size = 1 + binary_data_size;
+		}
+		else
+		{
+			segment_data_size = 1 + ( ( ( binary_data_size + 7 ) / 8 ) * 9 );
+		}
+		segment_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * segment_data_size );
+
+		if( segment_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     segment_data,
+		     0,
+		     sizeof( uint8_t ) * segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment data.",
+			 function );
+
+			goto on_error;
+		}
+		segment_data[ 0 ] = LIBESEDB_KEY_SEGMENT_PREFIX_DATA;
+
+		segment_data_offset = 1;
+
+		if( column_catalog_definition->identifier <= 127 )
+		{
+			if( memory_copy(
+			     &( segment_data[ segment_data_offset ] ),
+			     binary_data,
+			     binary_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy binary data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			while( binary_data_offset < binary_data_size )
+			{
+				chunk_size = binary_data_size - binary_data_offset;
+
+				if( chunk_size > 8 )
+				{
+					chunk_size = 8;
+				}
+				if( memory_copy(
+				     &( segment_data[ segment_data_offset ] ),
+				     &( binary_data[ binary_data_offset ] ),
+				     chunk_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy binary data chunk.",
+					 function );
+
+					goto on_error;
+				}
+				binary_data_offset  += chunk_size;
+				segment_data_offset += 8;
+
+				if( binary_data_offset < binary_data_size )
+				{
+					segment_data[ segment_data_offset ] = 9;
+				}
+				else
+				{
+					segment_data[ segment_data_offset ] = (uint8_t) chunk_size;
+				}
+				segment_data_offset += 1;
+			}
+		}
+	}
+	if( libesedb_internal_index_key_append_segment_data(
+	     internal_index_key,
+	     segment_data,
+	     segment_data_size,
+	     key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment data.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_data != &segment_prefix )
+	{
+		memory_free(
+		 segment_data );
+	}
+	return( 1 );
+
+on_error:
+	if( ( segment_data != NULL )
+	 && ( segment_data != &segment_prefix ) )
+	{
+		memory_free(
+		 segment_data );
+	}
+	return( -1 );
+}
+
+/* Sets the normalized key data
+ * This is used to represent the key of an index entry, hence no key columns can be appended afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_key_set_data(
+     libesedb_internal_index_key_t *internal_index_key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libesedb_internal_index_key_set_data";
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->key_column_index != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index key - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key of an index entry can exceed the maximum key size of older format versions
+	 */
+	if( data_size > internal_index_key->maximum_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_index_key->data,
+		                            sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_index_key->data              = reallocation;
+		internal_index_key->maximum_data_size = data_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     internal_index_key->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_index_key->data_size        = data_size;
+	internal_index_key->key_column_index = internal_index_key->number_of_key_columns;
+
+	return( 1 );
+}
+
+/* Retrieves the segment of a specific key column
+ * The segment data offset and size are relative to the normalized key data
+ * Returns 1 if successful, 0 if the segment is missing due to truncation or -1 on error
+ */
+int libesedb_internal_index_key_get_segment(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *key_column_flags,
+     size_t *segment_data_offset,
+     size_t *segment_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *safe_column_catalog_definition = NULL;
+	static char *function                                         = "libesedb_internal_index_key_get_segment";
+	size_t data_offset                                            = 0;
+	size_t safe_segment_data_size                                 = 0;
+	uint8_t complement_mask                                       = 0;
+	uint8_t safe_key_column_flags                                 = 0;
+	int codepage                                                  = 0;
+	int segment_index                                             = 0;
+
+	if( internal_index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_column_index < 0 )
+	 || ( key_column_index >= internal_index_key->number_of_key_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_column_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key column flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The segments are not stored with their size, hence the preceding segments
+	 * are determined from the column type of their key column
+	 */
+	for( segment_index = 0;
+	     segment_index <= key_column_index;
+	     segment_index++ )
+	{
+		data_offset += safe_segment_data_size;
+
+		if( data_offset >= internal_index_key->data_size )
+		{
+			return( 0 );
+		}
+		if( libesedb_internal_index_key_get_key_column(
+		     internal_index_key,
+		     segment_index,
+		     &safe_column_catalog_definition,
+		     &safe_key_column_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key column: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( ( safe_key_column_flags & LIBESEDB_KEY_COLUMN_FLAG_IS_DESCENDING ) != 0 )
+		{
+			complement_mask = 0xff;
+		}
+		else
+		{
+			complement_mask = 0x00;
+		}
+		safe_segment_data_size = 1;
+
+		if( ( internal_index_key->data[ data_offset ] ^ complement_mask ) != LIBESEDB_KEY_SEGMENT_PREFIX_DATA )
+		{
+			continue;
+		}
+		switch( safe_column_catalog_definition->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				safe_segment_data_size += 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				safe_segment_data_size += 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				safe_segment_data_size += 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				safe_segment_data_size += 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_GUID:
+				safe_segment_data_size += 16;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				codepage = (int) safe_column_catalog_definition->codepage;
+
+				if( codepage == 0 )
+				{
+					codepage = internal_index_key->internal_index->io_handle->ascii_codepage;
+				}
+				if( codepage == 1200 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported Unicode text column: %" PRIu32 " of key column: %d.",
+					 function,
+					 safe_column_catalog_definition->identifier,
+					 segment_index );
+
+					return( -1 );
+				}
+				/* The text is terminated by 0
+				 */
+				while( ( data_offset + safe_segment_data_size ) < internal_index_key->data_size )
+				{
+					safe_segment_data_size += 1;
+
+					if( ( internal_index_key->data[ data_offset + safe_segment_data_size - 1 ] ^ complement_mask ) == 0 )
+					{
+						break;
+					}
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+				if( safe_column_catalog_definition->identifier <= 127 )
+				{
+					safe_segment_data_size += (size_t) safe_column_catalog_definition->size;
+				}
+				else
+				{
+					/* The chunks of a variable size column are followed by 9 if more chunks follow
+					 */
+					while( ( data_offset + safe_segment_data_size + 9 ) <= internal_index_key->data_size )
+					{
+						safe_segment_data_size += 9;
+
+						if( ( internal_index_key->data[ data_offset + safe_segment_data_size - 1 ] ^ complement_mask ) != 9 )
+						{
+							break;
+						}
+					}
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported column type: %" PRIu32 " of key column: %d.",
+				 function,
+				 safe_column_catalog_definition->column_type,
+				 segment_index );
+
+				return( -1 );
+		}
+		if( safe_segment_data_size > ( internal_index_key->data_size - data_offset ) )
+		{
+			safe_segment_data_size = internal_index_key->data_size - data_offset;
+		}
+	}
+	*column_catalog_definition = safe_column_catalog_definition;
+	*key_column_flags          = safe_key_column_flags;
+	*segment_data_offset       = data_offset;
+	*segment_data_size         = safe_segment_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves a fixed size value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_internal_index_key_get_fixed_size_value(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     uint8_t value_type,
+     size_t value_size,
+     uint8_t *value_data,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_internal_index_key_get_fixed_size_value";
+	size_t segment_data_index                                = 0;
+	size_t segment_data_offset                               = 0;
+	size_t segment_data_size                                 = 0;
+	uint64_t safe_value_64bit                                = 0;
+	uint64_t sign_bit                                        = 0;
+	uint8_t complement_mask                                  = 0;
+	uint8_t key_column_flags                                 = 0;
+	uint8_t segment_prefix                                   = 0;
+	uint8_t byte_value                                       = 0;
+	int result                                               = 0;
+
+	if( ( value_size == 0 )
+	 || ( value_size > 16 )
+	 || ( ( value_data == NULL )
+	  && ( value_size > 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_64bit == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_segment(
+	          internal_index_key,
+	          key_column_index,
+	          &column_catalog_definition,
+	          &key_column_flags,
+	          &segment_data_offset,
+	          &segment_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing segment of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_BOOLEAN ) && ( value_size == 1 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER ) && ( value_size == 1 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER ) && ( value_size == 2 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER ) && ( value_size == 4 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER ) && ( value_size == 8 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT ) && ( value_size == 4 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT ) && ( value_size == 8 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_FILETIME ) && ( value_size == 8 );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			result = ( value_type == LIBESEDB_INDEX_KEY_VALUE_TYPE_GUID ) && ( value_size == 16 );
+			break;
+
+		default:
+			result = 0;
+			break;
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value for column type: %" PRIu32 " of key column: %d.",
+		 function,
+		 column_catalog_definition->column_type,
+		 key_column_index );
+
+		return( -1 );
+	}
+	if( ( key_column_flags & LIBESEDB_KEY_COLUMN_FLAG_IS_DESCENDING ) != 0 )
+	{
+		complement_mask = 0xff;
+	}
+	segment_prefix = internal_index_key->data[ segment_data_offset ] ^ complement_mask;
+
+	if( ( segment_prefix == LIBESEDB_KEY_SEGMENT_PREFIX_NULL )
+	 || ( segment_prefix == LIBESEDB_KEY_SEGMENT_PREFIX_NULL_HIGH ) )
+	{
+		return( 0 );
+	}
+	if( ( segment_prefix != LIBESEDB_KEY_SEGMENT_PREFIX_DATA )
+	 || ( segment_data_size != ( value_size + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported segment of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	segment_data_offset += 1;
+
+	if( value_data != NULL )
+	{
+		for( segment_data_index = 0;
+		     segment_data_index < value_size;
+		     segment_data_index++ )
+		{
+			value_data[ segment_data_index ] = internal_index_key->data[ segment_data_offset + segment_data_index ] ^ complement_mask;
+		}
+		return( 1 );
+	}
+	for( segment_data_index = 0;
+	     segment_data_index < value_size;
+	     segment_data_index++ )
+	{
+		byte_value = internal_index_key->data[ segment_data_offset + segment_data_index ] ^ complement_mask;
+
+		safe_value_64bit <<= 8;
+		safe_value_64bit  |= byte_value;
+	}
+	sign_bit = (uint64_t) 1 << ( ( value_size * 8 ) - 1 );
+
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			if( safe_value_64bit != 0 )
+			{
+				safe_value_64bit = 1;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			safe_value_64bit ^= sign_bit;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			if( ( safe_value_64bit & sign_bit ) != 0 )
+			{
+				safe_value_64bit ^= sign_bit;
+			}
+			else
+			{
+				safe_value_64bit = ~safe_value_64bit;
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( value_size < 8 )
+	{
+		safe_value_64bit &= ( (uint64_t) 1 << ( value_size * 8 ) ) - 1;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the column identifier of a specific key column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_key_get_column_identifier(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	static char *function                             = "libesedb_index_key_get_column_identifier";
+	uint8_t key_column_flags                          = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( internal_index_key->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index key - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_key_column(
+	     internal_index_key->internal_index->index_catalog_definition,
+	     key_column_index,
+	     column_identifier,
+	     &key_column_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the boolean value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_boolean(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *value_boolean,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_boolean";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_boolean == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value boolean.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_BOOLEAN,
+	          1,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve boolean value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_boolean = (uint8_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the 8-bit value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_8bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *value_8bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_8bit";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_8bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 8-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	          1,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 8-bit value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_8bit = (uint8_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the 16-bit value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_16bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint16_t *value_16bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_16bit";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_16bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 16-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	          2,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 16-bit value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_16bit = (uint16_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the 32-bit value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_32bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_32bit";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	          4,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 32-bit value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_32bit = (uint32_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_64bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_64bit";
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_INTEGER,
+	          8,
+	          NULL,
+	          value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 64-bit value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit FILETIME value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_filetime(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint64_t *value_filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_key_get_value_filetime";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_FILETIME,
+	          8,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve FILETIME value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value_filetime = value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the 32-bit floating-point value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_floating_point_32bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     float *value_floating_point_32bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float32_t value_float32;
+
+	static char *function = "libesedb_index_key_get_value_floating_point_32bit";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_floating_point_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit floating-point.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT,
+	          4,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 32-bit floating-point value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		value_float32.integer = (uint32_t) value_64bit;
+
+		*value_floating_point_32bit = value_float32.floating_point;
+	}
+	return( result );
+}
+
+/* Retrieves the 64-bit floating-point value of a specific key column
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_floating_point_64bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     double *value_floating_point_64bit,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t value_float64;
+
+	static char *function = "libesedb_index_key_get_value_floating_point_64bit";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_floating_point_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit floating-point.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_FLOATING_POINT,
+	          8,
+	          NULL,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve 64-bit floating-point value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		value_float64.integer = value_64bit;
+
+		*value_floating_point_64bit = value_float64.floating_point;
+	}
+	return( result );
+}
+
+/* Retrieves the GUID value of a specific key column
+ * The GUID data is stored in little-endian as in the record value data
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_index_key_get_value_guid(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t segment_data[ 16 ];
+
+	libesedb_internal_index_key_t *internal_index_key = NULL;
+	const uint8_t *guid_byte_order                    = NULL;
+	static char *function                             = "libesedb_index_key_get_value_guid";
+	uint8_t guid_byte_index                           = 0;
+	int result                                        = 0;
+
+	if( index_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index_key = (libesedb_internal_index_key_t *) index_key;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index_key->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index key - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_index_key_get_fixed_size_value(
+	          internal_index_key,
+	          key_column_index,
+	          LIBESEDB_INDEX_KEY_VALUE_TYPE_GUID,
+	          16,
+	          segment_data,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve GUID value of key column: %d.",
+		 function,
+		 key_column_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( internal_index_key->internal_index->index_catalog_definition->flags & LIBESEDB_INDEX_FLAG_DOT_NET_GUID ) != 0 )
+		{
+			guid_byte_order = libesedb_index_key_dot_net_guid_byte_order;
+		}
+		else
+		{
+			guid_byte_order = libesedb_index_key_guid_byte_order;
+		}
+		for( guid_byte_index = 0;
+		     guid_byte_index < 16;
+		     guid_byte_index++ )
+		{
+			guid_data[ guid_byte_order[ guid_byte_index ] ] = segment_data[ guid_byte_index ];
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,298 @@
+/*
+ * Index key functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INDEX_KEY_H )
+#define _LIBESEDB_INDEX_KEY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_index.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t libesedb_index_key_guid_byte_order[ 16 ];
+
+extern const uint8_t libesedb_index_key_dot_net_guid_byte_order[ 16 ];
+
+typedef struct libesedb_internal_index_key libesedb_internal_index_key_t;
+
+struct libesedb_internal_index_key
+{
+	/* The index
+	 */
+	libesedb_internal_index_t *internal_index;
+
+	/* The number of key columns
+	 */
+	int number_of_key_columns;
+
+	/* The index of the key column of the next segment
+	 */
+	int key_column_index;
+
+	/* The normalized key data
+	 */
+	uint8_t *data;
+
+	/* The normalized key data size
+	 */
+	size_t data_size;
+
+	/* The maximum normalized key data size
+	 */
+	size_t maximum_data_size;
+
+	/* Value to indicate the normalized key data was truncated
+	 */
+	uint8_t is_truncated;
+};
+
+int libesedb_index_key_initialize(
+     libesedb_index_key_t **index_key,
+     libesedb_internal_index_t *internal_index,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_free(
+     libesedb_index_key_t **index_key,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_set_data(
+     libesedb_internal_index_key_t *internal_index_key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_get_key_column(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *key_column_flags,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_append_segment_data(
+     libesedb_internal_index_key_t *internal_index_key,
+     const uint8_t *segment_data,
+     size_t segment_data_size,
+     uint8_t key_column_flags,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_append_fixed_size_value(
+     libesedb_internal_index_key_t *internal_index_key,
+     uint64_t value_64bit,
+     size_t value_size,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_data_size(
+     libesedb_index_key_t *index_key,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_data(
+     libesedb_index_key_t *index_key,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_is_truncated(
+     libesedb_index_key_t *index_key,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_null(
+     libesedb_index_key_t *index_key,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_boolean(
+     libesedb_index_key_t *index_key,
+     uint8_t value_boolean,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_8bit(
+     libesedb_index_key_t *index_key,
+     uint8_t value_8bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_16bit(
+     libesedb_index_key_t *index_key,
+     uint16_t value_16bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_32bit(
+     libesedb_index_key_t *index_key,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_64bit(
+     libesedb_index_key_t *index_key,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_filetime(
+     libesedb_index_key_t *index_key,
+     uint64_t value_filetime,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_floating_point_32bit(
+     libesedb_index_key_t *index_key,
+     float value_floating_point_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_floating_point_64bit(
+     libesedb_index_key_t *index_key,
+     double value_floating_point_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_guid(
+     libesedb_index_key_t *index_key,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_utf8_string(
+     libesedb_index_key_t *index_key,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_append_binary_data(
+     libesedb_index_key_t *index_key,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_get_segment(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     uint8_t *key_column_flags,
+     size_t *segment_data_offset,
+     size_t *segment_data_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_key_get_fixed_size_value(
+     libesedb_internal_index_key_t *internal_index_key,
+     int key_column_index,
+     uint8_t value_type,
+     size_t value_size,
+     uint8_t *value_data,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_column_identifier(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint32_t *column_identifier,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_boolean(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *value_boolean,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_8bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *value_8bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_16bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint16_t *value_16bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_32bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_64bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_filetime(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint64_t *value_filetime,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_floating_point_32bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     float *value_floating_point_32bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_floating_point_64bit(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     double *value_floating_point_64bit,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_key_get_value_guid(
+     libesedb_index_key_t *index_key,
+     int key_column_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INDEX_KEY_H ) */
+
@@ -32,6 +32,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_unused.h"
@@ -222,6 +223,89 @@ int libesedb_io_handle_set_pages_data_range(
 	return( 1 );
 }
 
+/* Grabs the read/write lock of the IO handle for write
+ * Nothing is locked if the IO handle has no read/write lock, like the IO handle of a scan worker
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_grab_for_write(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_grab_for_write";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	if( io_handle->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the read/write lock of the IO handle for write
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_release_for_write(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_release_for_write";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	if( io_handle->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     io_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
 /* Reads a page
  * Callback function for the page vector
  * Returns 1 if successful or -1 on error
@@ -247,6 +331,22 @@ int libesedb_io_handle_read_page(
 	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
 	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->pages_cache != NULL )
+	 && ( cache == io_handle->pages_cache ) )
+	{
+		io_handle->number_of_pages_cache_misses += 1;
+	}
 	if( libesedb_page_initialize(
 	     &page,
 	     error ) != 1 )
@@ -27,7 +27,10 @@
 
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_memory_map.h"
+#include "libesedb_sidecar.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -79,6 +82,41 @@ struct libesedb_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The (file-wide) pages cache reference
+	 * used to distinguish pages cache misses from reads into local caches
+	 */
+	libfdata_cache_t *pages_cache;
+
+	/* The number of pages cache lookups
+	 */
+	uint64_t number_of_pages_cache_lookups;
+
+	/* The number of pages cache misses
+	 */
+	uint64_t number_of_pages_cache_misses;
+
+	/* The memory map reference
+	 * used to read pages directly from the mapped file data
+	 */
+	libesedb_memory_map_t *memory_map;
+
+	/* The sidecar cache file reference
+	 * used to restore the catalog and leaf page descriptors without reading the pages
+	 * or to record the catalog values when the sidecar is being built
+	 */
+	libesedb_sidecar_t *sidecar;
+
+	/* Value to indicate the page checksums should not be verified when reading pages
+	 */
+	uint8_t skip_checksum_verification;
+
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	/* The (file-wide) read/write lock reference
+	 * used to serialize access to the file IO handle and the pages cache
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -101,6 +139,14 @@ int libesedb_io_handle_set_pages_data_range(
      size64_t file_size,
      libcerror_error_t **error );
 
+int libesedb_io_handle_grab_for_write(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_release_for_write(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libesedb_io_handle_read_page(
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -26,6 +26,7 @@
 
 #include "libesedb_data_segment.h"
 #include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
@@ -280,6 +281,78 @@ int libesedb_long_value_get_data_size(
 	return( 1 );
 }
 
+/* Retrieve a specific data segment
+ * The file IO handle is shared with the file hence access is serialized
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_long_value_get_data_segment_by_index(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     libesedb_data_segment_t **data_segment,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_long_value_get_data_segment_by_index";
+	int result            = 1;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_long_value->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_value_by_index(
+	     internal_long_value->data_segments_list,
+	     (intptr_t *) internal_long_value->file_io_handle,
+	     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+	     data_segment_index,
+	     (intptr_t **) data_segment,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		result = -1;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_long_value->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieve the data
  * Returns 1 if successful or -1 on error
  */
@@ -375,13 +448,10 @@ int libesedb_long_value_get_data(
 	     data_segment_index < number_of_data_segments;
 	     data_segment_index++ )
 	{
-		if( libfdata_list_get_element_value_by_index(
-		     internal_long_value->data_segments_list,
-		     (intptr_t *) internal_long_value->file_io_handle,
-		     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+		if( libesedb_internal_long_value_get_data_segment_by_index(
+		     internal_long_value,
 		     data_segment_index,
-		     (intptr_t **) &data_segment,
-		     0,
+		     &data_segment,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -425,6 +495,389 @@ int libesedb_long_value_get_data(
 	return( 1 );
 }
 
+/* Retrieve the data segment at a specific offset
+ * The file IO handle is shared with the file hence access is serialized
+ * Returns 1 if successful, 0 if no such data segment or -1 on error
+ */
+int libesedb_internal_long_value_get_data_segment_at_offset(
+     libesedb_internal_long_value_t *internal_long_value,
+     off64_t offset,
+     off64_t *data_segment_data_offset,
+     libesedb_data_segment_t **data_segment,
+     libcerror_error_t **error )
+{
+	static char *function  = "libesedb_internal_long_value_get_data_segment_at_offset";
+	int data_segment_index = 0;
+	int result             = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_long_value->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfdata_list_get_element_value_at_offset(
+	          internal_long_value->data_segments_list,
+	          (intptr_t *) internal_long_value->file_io_handle,
+	          (libfdata_cache_t *) internal_long_value->data_segments_cache,
+	          offset,
+	          &data_segment_index,
+	          data_segment_data_offset,
+	          (intptr_t **) data_segment,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_long_value->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads data at the current offset into a buffer
+ * Only the data segments that contain the requested range are read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment               = NULL;
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_read_buffer";
+	size64_t data_size                                  = 0;
+	size_t buffer_offset                                = 0;
+	size_t read_size                                    = 0;
+	off64_t data_segment_data_offset                    = 0;
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( internal_long_value->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid long value - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_size(
+	     internal_long_value->data_segments_list,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from data segments list.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_long_value->current_offset >= data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( data_size - internal_long_value->current_offset ) )
+	{
+		buffer_size = (size_t) ( data_size - internal_long_value->current_offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = libesedb_internal_long_value_get_data_segment_at_offset(
+		          internal_long_value,
+		          internal_long_value->current_offset,
+		          &data_segment_data_offset,
+		          &data_segment,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_long_value->current_offset,
+			 internal_long_value->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( data_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data segment.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( data_segment_data_offset < 0 )
+		 || ( (size64_t) data_segment_data_offset >= (size64_t) data_segment->data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data segment data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = data_segment->data_size - (size_t) data_segment_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( data_segment->data[ data_segment_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                       += read_size;
+		internal_long_value->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_seek_offset";
+	size64_t data_size                                  = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_long_value->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libfdata_list_get_size(
+		     internal_long_value->data_segments_list,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size from data segments list.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value->current_offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_offset";
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_long_value->current_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_size(
+     libesedb_long_value_t *long_value,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_long_value_get_size";
+
+	if( libesedb_long_value_get_data_size(
+	     long_value,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieve the record value
  * Returns 1 if successful or -1 on error
  */
@@ -537,13 +990,10 @@ int libesedb_long_value_get_record_value(
 		     data_segment_index < number_of_data_segments;
 		     data_segment_index++ )
 		{
-			if( libfdata_list_get_element_value_by_index(
-			     internal_long_value->data_segments_list,
-			     (intptr_t *) internal_long_value->file_io_handle,
-			     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+			if( libesedb_internal_long_value_get_data_segment_by_index(
+			     internal_long_value,
 			     data_segment_index,
-			     (intptr_t **) &data_segment,
-			     0,
+			     &data_segment,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -767,13 +1217,10 @@ int libesedb_long_value_get_data_segment_size(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
-	if( libfdata_list_get_element_value_by_index(
-	     internal_long_value->data_segments_list,
-	     (intptr_t *) internal_long_value->file_io_handle,
-	     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+	if( libesedb_internal_long_value_get_data_segment_by_index(
+	     internal_long_value,
 	     data_segment_index,
-	     (intptr_t **) &data_segment,
-	     0,
+	     &data_segment,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -831,13 +1278,10 @@ int libesedb_long_value_get_data_segment(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
-	if( libfdata_list_get_element_value_by_index(
-	     internal_long_value->data_segments_list,
-	     (intptr_t *) internal_long_value->file_io_handle,
-	     (libfdata_cache_t *) internal_long_value->data_segments_cache,
+	if( libesedb_internal_long_value_get_data_segment_by_index(
+	     internal_long_value,
 	     data_segment_index,
-	     (intptr_t **) &data_segment,
-	     0,
+	     &data_segment,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
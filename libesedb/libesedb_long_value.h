@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_catalog_definition.h"
+#include "libesedb_data_segment.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -66,6 +67,10 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
 };
 
 int libesedb_long_value_initialize(
@@ -81,6 +86,12 @@ int libesedb_long_value_free(
      libesedb_long_value_t **long_value,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data_segment_by_index(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     libesedb_data_segment_t **data_segment,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data_size(
      libesedb_long_value_t *long_value,
@@ -94,6 +105,39 @@ int libesedb_long_value_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data_segment_at_offset(
+     libesedb_internal_long_value_t *internal_long_value,
+     off64_t offset,
+     off64_t *data_segment_data_offset,
+     libesedb_data_segment_t **data_segment,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+off64_t libesedb_long_value_seek_offset(
+         libesedb_long_value_t *long_value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_offset(
+     libesedb_long_value_t *long_value,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_long_value_get_size(
+     libesedb_long_value_t *long_value,
+     size64_t *size,
+     libcerror_error_t **error );
+
 int libesedb_long_value_get_record_value(
      libesedb_internal_long_value_t *internal_long_value,
      libfvalue_value_t **record_value,
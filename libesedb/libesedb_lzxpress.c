@@ -0,0 +1,437 @@
+/*
+ * LZXPRESS (LZ77 + DIRECT2) decompression functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_lzxpress.h"
+
+/* The maximum size of a run of literals that is copied a byte at a time
+ */
+#define LIBESEDB_LZXPRESS_MAXIMUM_LITERAL_BYTE_COPY_SIZE	16
+
+/* The maximum size of a match that is copied a byte at a time
+ */
+#define LIBESEDB_LZXPRESS_MAXIMUM_MATCH_BYTE_COPY_SIZE		32
+
+/* Decompresses LZXPRESS (LZ77 + DIRECT2) compressed data
+ * Literal runs and non-overlapping matches are copied as a whole,
+ * overlapping matches are copied a match distance at a time
+ * Runs and matches of a few bytes are copied a byte at a time, which is
+ * faster than a memory copy of the same size
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_lzxpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "libesedb_lzxpress_decompress";
+	size_t compressed_data_offset        = 0;
+	size_t compression_nibble_offset     = 0;
+	size_t copy_size                     = 0;
+	size_t literal_size                  = 0;
+	size_t match_offset                  = 0;
+	size_t safe_uncompressed_data_size   = 0;
+	size_t uncompressed_data_offset      = 0;
+	uint32_t compression_indicator       = 0;
+	uint32_t compression_tuple_offset    = 0;
+	uint32_t compression_tuple_size      = 0;
+	uint16_t compression_tuple           = 0;
+	uint8_t compression_indicator_bit    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( ( compressed_data_size - compressed_data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_indicator );
+
+		compressed_data_offset += 4;
+
+		compression_indicator_bit = 0;
+
+		while( compression_indicator_bit < 32 )
+		{
+			if( compressed_data_offset >= compressed_data_size )
+			{
+				break;
+			}
+			if( ( compression_indicator & 0x80000000UL ) == 0 )
+			{
+				/* Determine the size of the run of literals, which corresponds
+				 * to the number of leading zero bits of the compression indicator
+				 */
+				literal_size = 1;
+
+				while( ( ( compression_indicator_bit + literal_size ) < 32 )
+				    && ( ( compression_indicator & ( 0x80000000UL >> literal_size ) ) == 0 ) )
+				{
+					literal_size++;
+				}
+				if( literal_size > ( compressed_data_size - compressed_data_offset ) )
+				{
+					literal_size = compressed_data_size - compressed_data_offset;
+				}
+				if( literal_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( literal_size <= LIBESEDB_LZXPRESS_MAXIMUM_LITERAL_BYTE_COPY_SIZE )
+				{
+					for( copy_size = 0;
+					     copy_size < literal_size;
+					     copy_size++ )
+					{
+						uncompressed_data[ uncompressed_data_offset + copy_size ] = compressed_data[ compressed_data_offset + copy_size ];
+					}
+				}
+				else if( memory_copy(
+				          &( uncompressed_data[ uncompressed_data_offset ] ),
+				          &( compressed_data[ compressed_data_offset ] ),
+				          literal_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy literals to uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				compressed_data_offset   += literal_size;
+				uncompressed_data_offset += literal_size;
+
+				if( literal_size < 32 )
+				{
+					compression_indicator <<= literal_size;
+				}
+				else
+				{
+					compression_indicator = 0;
+				}
+				compression_indicator_bit += (uint8_t) literal_size;
+
+				continue;
+			}
+			if( ( compressed_data_size - compressed_data_offset ) < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 compression_tuple );
+
+			compressed_data_offset += 2;
+
+			compression_tuple_size   = (uint32_t) ( compression_tuple & 0x0007 );
+			compression_tuple_offset = (uint32_t) ( compression_tuple >> 3 ) + 1;
+
+			if( compression_tuple_size == 0x07 )
+			{
+				if( compression_nibble_offset == 0 )
+				{
+					if( compressed_data_offset >= compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					compression_nibble_offset = compressed_data_offset;
+
+					compression_tuple_size = (uint32_t) ( compressed_data[ compressed_data_offset ] & 0x0f );
+
+					compressed_data_offset += 1;
+				}
+				else
+				{
+					compression_tuple_size = (uint32_t) ( compressed_data[ compression_nibble_offset ] >> 4 );
+
+					compression_nibble_offset = 0;
+				}
+				if( compression_tuple_size == 0x0f )
+				{
+					if( compressed_data_offset >= compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					compression_tuple_size = (uint32_t) compressed_data[ compressed_data_offset ];
+
+					compressed_data_offset += 1;
+
+					if( compression_tuple_size == 0xff )
+					{
+						if( ( compressed_data_size - compressed_data_offset ) < 2 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data size value too small.",
+							 function );
+
+							return( -1 );
+						}
+						byte_stream_copy_to_uint16_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 compression_tuple_size );
+
+						compressed_data_offset += 2;
+
+						if( compression_tuple_size == 0 )
+						{
+							if( ( compressed_data_size - compressed_data_offset ) < 4 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+								 "%s: compressed data size value too small.",
+								 function );
+
+								return( -1 );
+							}
+							byte_stream_copy_to_uint32_little_endian(
+							 &( compressed_data[ compressed_data_offset ] ),
+							 compression_tuple_size );
+
+							compressed_data_offset += 4;
+						}
+						/* The size is stored without the 0x03 that is added below
+						 * hence a 32-bit size of 0xfffffffd or larger would wrap
+						 */
+						if( ( compression_tuple_size < ( 0x0f + 0x07 ) )
+						 || ( compression_tuple_size > ( (uint32_t) UINT32_MAX - 0x03 ) ) )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: compression tuple size value out of bounds.",
+							 function );
+
+							return( -1 );
+						}
+						compression_tuple_size -= 0x0f + 0x07;
+					}
+					compression_tuple_size += 0x0f;
+				}
+				compression_tuple_size += 0x07;
+			}
+			compression_tuple_size += 0x03;
+
+			if( (size_t) compression_tuple_offset > uncompressed_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: compression tuple offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( (size_t) compression_tuple_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( compression_tuple_size <= LIBESEDB_LZXPRESS_MAXIMUM_MATCH_BYTE_COPY_SIZE )
+			 || ( ( compression_tuple_offset > 1 )
+			  &&  ( compression_tuple_offset <= LIBESEDB_LZXPRESS_MAXIMUM_MATCH_BYTE_COPY_SIZE ) ) )
+			{
+				/* Short matches and matches with a short distance, other than 1,
+				 * are copied a byte at a time
+				 */
+				match_offset = uncompressed_data_offset - compression_tuple_offset;
+
+				while( compression_tuple_size > 0 )
+				{
+					uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+
+					compression_tuple_size--;
+				}
+			}
+			else if( compression_tuple_offset == 1 )
+			{
+				/* A match distance of 1 repeats the last byte
+				 */
+				if( memory_set(
+				     &( uncompressed_data[ uncompressed_data_offset ] ),
+				     uncompressed_data[ uncompressed_data_offset - 1 ],
+				     (size_t) compression_tuple_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to set uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data_offset += compression_tuple_size;
+			}
+			else
+			{
+				/* The match is copied in chunks of at most the match distance
+				 * so that the source and destination never overlap
+				 */
+				while( compression_tuple_size > 0 )
+				{
+					copy_size = (size_t) compression_tuple_offset;
+
+					if( copy_size > (size_t) compression_tuple_size )
+					{
+						copy_size = (size_t) compression_tuple_size;
+					}
+					if( memory_copy(
+					     &( uncompressed_data[ uncompressed_data_offset ] ),
+					     &( uncompressed_data[ uncompressed_data_offset - compression_tuple_offset ] ),
+					     copy_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy match to uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					uncompressed_data_offset += copy_size;
+					compression_tuple_size   -= (uint32_t) copy_size;
+				}
+			}
+			compression_indicator    <<= 1;
+			compression_indicator_bit += 1;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
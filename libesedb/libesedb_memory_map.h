@@ -0,0 +1,80 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_MEMORY_MAP_H )
+#define _LIBESEDB_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define LIBESEDB_HAVE_MEMORY_MAP	1
+#endif
+
+typedef struct libesedb_memory_map libesedb_memory_map_t;
+
+struct libesedb_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+};
+
+int libesedb_memory_map_initialize(
+     libesedb_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libesedb_memory_map_free(
+     libesedb_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libesedb_memory_map_open(
+     libesedb_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libesedb_memory_map_close(
+     libesedb_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+int libesedb_memory_map_get_data(
+     libesedb_memory_map_t *memory_map,
+     off64_t offset,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_MEMORY_MAP_H ) */
+
@@ -31,6 +31,8 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_header.h"
 #include "libesedb_page_value.h"
@@ -198,7 +200,8 @@ int libesedb_page_free(
 
 			result = -1;
 		}
-		if( ( *page )->data != NULL )
+		if( ( ( *page )->data != NULL )
+		 && ( ( *page )->data_is_mapped == 0 ) )
 		{
 			memory_free(
 			 ( *page )->data );
@@ -211,6 +214,91 @@ int libesedb_page_free(
 	return( result );
 }
 
+/* Replaces the memory mapped data of a page by a copy
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_copy_mapped_data(
+     libesedb_page_t *page,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_page_copy_mapped_data";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data_is_mapped == 0 )
+	{
+		return( 1 );
+	}
+	if( page->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page->data_size == 0 )
+	 || ( page->data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    page->data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     page->data,
+	     page->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+	page->data           = data;
+	page->data_is_mapped = 0;
+
+	return( 1 );
+}
+
 /* Calculates the page checksums
  * Returns 1 if successful, 0 if page is empty or -1 on error
  */
@@ -669,6 +757,61 @@ int libesedb_page_read_values(
 	}
 	page_values_data_size -= page_tags_data_size;
 
+	if( ( page->data_is_mapped != 0 )
+	 && ( page_data == page->data )
+	 && ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		/* The page tags flags are removed from the page values data below
+		 * which requires a copy of the memory mapped data when any flags are set
+		 */
+		for( page_tags_index = 0;
+		     page_tags_index < number_of_page_tags;
+		     page_tags_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     page->values_array,
+			     page_tags_index,
+			     (intptr_t **) &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_tags_index );
+
+				goto on_error;
+			}
+			if( ( page_value != NULL )
+			 && ( page_value->size >= 2 )
+			 && ( ( (size_t) page_value->offset + 1 ) < page_values_data_size )
+			 && ( ( page_values_data[ page_value->offset + 1 ] & 0xe0 ) != 0 ) )
+			{
+				break;
+			}
+		}
+		if( page_tags_index < number_of_page_tags )
+		{
+			if( libesedb_page_copy_mapped_data(
+			     page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy mapped page data.",
+				 function );
+
+				goto on_error;
+			}
+			page_data        = page->data;
+			page_values_data = &( page_data[ page_values_data_offset ] );
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -767,7 +910,10 @@ int libesedb_page_read_values(
 				 */
 				page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
 
-				page_values_data[ page_value->offset + 1 ] &= 0x1f;
+				if( page_value->flags != 0 )
+				{
+					page_values_data[ page_value->offset + 1 ] &= 0x1f;
+				}
 			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -821,21 +967,19 @@ on_error:
 	return( -1 );
 }
 
-/* Reads a page and its values
+/* Reads the page data and header
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_read_file_io_handle(
+int libesedb_page_read_data_file_io_handle(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function              = "libesedb_page_read_file_io_handle";
-	ssize_t read_count                 = 0;
-	uint32_t calculated_ecc32_checksum = 0;
-	uint32_t calculated_xor32_checksum = 0;
-	int result                         = 0;
+	static char *function = "libesedb_page_read_data_file_io_handle";
+	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( page == NULL )
 	{
@@ -897,54 +1041,83 @@ int libesedb_page_read_file_io_handle(
 		 page->offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( io_handle->memory_map != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
+		result = libesedb_memory_map_get_data(
+		          io_handle->memory_map,
+		          page->offset,
+		          (size_t) io_handle->page_size,
+		          &( page->data ),
+		          error );
 
-		goto on_error;
-	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped page data.",
+			 function );
 
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			page->data_size      = (size_t) io_handle->page_size;
+			page->data_is_mapped = 1;
+		}
+	}
 	if( page->data == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
-		 function );
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     page->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek page offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
 
-		goto on_error;
-	}
-	page->data_size = (size_t) io_handle->page_size;
+			goto on_error;
+		}
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
 
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
+			goto on_error;
+		}
+		page->data_size = (size_t) io_handle->page_size;
 
-	if( read_count != (ssize_t) page->data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
-		 function );
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              error );
 
-		goto on_error;
+		if( read_count != (ssize_t) page->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libesedb_page_header_read_data(
 	     page->header,
@@ -962,6 +1135,68 @@ int libesedb_page_read_file_io_handle(
 
 		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	if( page->data != NULL )
+	{
+		if( page->data_is_mapped == 0 )
+		{
+			memory_free(
+			 page->data );
+		}
+		page->data           = NULL;
+		page->data_is_mapped = 0;
+	}
+	return( -1 );
+}
+
+/* Verifies the page checksums
+ * Returns 1 if the checksums match or are not calculated, 0 if not or -1 on error
+ */
+int libesedb_page_verify_checksums(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function              = "libesedb_page_verify_checksums";
+	uint32_t calculated_ecc32_checksum = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	int result                         = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	result = libesedb_page_calculate_checksums(
 	          page,
 	          io_handle,
@@ -980,58 +1215,103 @@ int libesedb_page_read_file_io_handle(
 		 "%s: unable to calculate page checksums.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
 	}
-	else if( result != 0 )
+	if( page->header->xor32_checksum != calculated_xor32_checksum )
 	{
-		if( page->header->xor32_checksum != calculated_xor32_checksum )
+		if( libcnotify_verbose != 0 )
 		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+			libcnotify_printf(
+			 "%s: mismatch in page: %" PRIu32 " XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
 			 function,
+			 page->page_number,
 			 page->header->xor32_checksum,
 			 calculated_xor32_checksum );
-
-			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-				 function,
-				 page->header->xor32_checksum,
-				 calculated_xor32_checksum );
-			}
-#endif
 		}
-		if( page->header->ecc32_checksum != calculated_ecc32_checksum )
+		result = 0;
+	}
+	if( page->header->ecc32_checksum != calculated_ecc32_checksum )
+	{
+		if( libcnotify_verbose != 0 )
 		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+			libcnotify_printf(
+			 "%s: mismatch in page: %" PRIu32 " ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
 			 function,
+			 page->page_number,
 			 page->header->ecc32_checksum,
 			 calculated_ecc32_checksum );
+		}
+		result = 0;
+	}
+	return( result );
+}
+
+/* Reads a page and its values
+ * The page checksums are verified unless checksum verification is disabled in the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read_file_io_handle(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_read_file_io_handle";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_read_data_file_io_handle(
+	     page,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->skip_checksum_verification == 0 )
+	{
+		result = libesedb_page_verify_checksums(
+		          page,
+		          io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page checksums.",
+			 function );
 
 			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-				 function,
-				 page->header->ecc32_checksum,
-				 calculated_ecc32_checksum );
-			}
-#endif
 		}
+		/* A checksum mismatch is only reported in verbose output by
+		 * libesedb_page_verify_checksums, the page values are still read
+		 */
 	}
 	if( libesedb_page_read_values(
 	     page,
@@ -1055,14 +1335,88 @@ int libesedb_page_read_file_io_handle(
 on_error:
 	if( page->data != NULL )
 	{
-		memory_free(
-		 page->data );
-
-		page->data = NULL;
+		if( page->data_is_mapped == 0 )
+		{
+			memory_free(
+			 page->data );
+		}
+		page->data           = NULL;
+		page->data_is_mapped = 0;
 	}
 	return( -1 );
 }
 
+/* Retrieves a page from the pages vector
+ * Every page retrieved through the (file-wide) pages cache of the IO handle is
+ * counted as a pages cache lookup, a miss is counted by libesedb_io_handle_read_page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_from_pages_vector(
+     libfdata_vector_t *pages_vector,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_get_from_pages_vector";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_INT <= 4 )
+	if( ( page_number == 0 )
+	 || ( page_number > (uint32_t) INT_MAX ) )
+#else
+	if( ( page_number == 0 )
+	 || ( (int) page_number > INT_MAX ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->pages_cache != NULL )
+	 && ( (libfdata_cache_t *) pages_cache == io_handle->pages_cache ) )
+	{
+		io_handle->number_of_pages_cache_lookups += 1;
+	}
+	if( libfdata_vector_get_element_value_by_index(
+	     pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) pages_cache,
+	     (int) page_number - 1,
+	     (intptr_t **) page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Checks if the page is valid root page
  * Returns 1 if successful or -1 on error
  */
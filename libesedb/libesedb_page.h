@@ -29,6 +29,8 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
 #include "libesedb_page_header.h"
 #include "libesedb_page_value.h"
 
@@ -60,6 +62,10 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the data references memory mapped file data
+	 */
+	uint8_t data_is_mapped;
+
 	/* The values array
 	 */
 	libcdata_array_t *values_array;
@@ -73,6 +79,10 @@ int libesedb_page_free(
      libesedb_page_t **page,
      libcerror_error_t **error );
 
+int libesedb_page_copy_mapped_data(
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
 int libesedb_page_calculate_checksums(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -98,6 +108,18 @@ int libesedb_page_read_values(
      size_t page_values_data_offset,
      libcerror_error_t **error );
 
+int libesedb_page_read_data_file_io_handle(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libesedb_page_verify_checksums(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libesedb_page_read_file_io_handle(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -105,6 +127,15 @@ int libesedb_page_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libesedb_page_get_from_pages_vector(
+     libfdata_vector_t *pages_vector,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *pages_cache,
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
 int libesedb_page_validate_root_page(
      libesedb_page_t *page,
      libcerror_error_t **error );
@@ -39,11 +39,13 @@
 #include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_root_page_header.h"
+#include "libesedb_sidecar.h"
 #include "libesedb_space_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_unused.h"
 
 #include "esedb_page_values.h"
+#include "esedb_sidecar.h"
 
 /* Creates a page tree
  * Make sure the value page_tree is referencing, is set to NULL
@@ -159,14 +161,15 @@ int libesedb_page_tree_initialize(
 
 		goto on_error;
 	}
-	( *page_tree )->io_handle                 = io_handle;
-	( *page_tree )->pages_vector              = pages_vector;
-	( *page_tree )->pages_cache               = pages_cache;
-	( *page_tree )->object_identifier         = object_identifier;
-	( *page_tree )->root_page_number          = root_page_number;
-	( *page_tree )->table_definition          = table_definition;
-	( *page_tree )->template_table_definition = template_table_definition;
-	( *page_tree )->number_of_leaf_values     = -1;
+	( *page_tree )->io_handle                  = io_handle;
+	( *page_tree )->pages_vector               = pages_vector;
+	( *page_tree )->pages_cache                = pages_cache;
+	( *page_tree )->object_identifier          = object_identifier;
+	( *page_tree )->root_page_number           = root_page_number;
+	( *page_tree )->table_definition           = table_definition;
+	( *page_tree )->template_table_definition  = template_table_definition;
+	( *page_tree )->number_of_leaf_values      = -1;
+	( *page_tree )->number_of_read_leaf_values = -1;
 
 	return( 1 );
 
@@ -1052,13 +1055,13 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 		if( ( child_page_number > 0 )
 		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 		{
-			if( libfdata_vector_get_element_value_by_index(
+			if( libesedb_page_get_from_pages_vector(
 			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) child_page_number - 1,
-			     (intptr_t **) &child_page,
-			     0,
+			     file_io_handle,
+			     page_tree->pages_cache,
+			     page_tree->io_handle,
+			     child_page_number,
+			     &child_page,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1175,13 +1178,13 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
+	if( libesedb_page_get_from_pages_vector(
 	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) page_tree->pages_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &page,
-	     0,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     page_tree->root_page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1281,13 +1284,13 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 	{
 		last_leaf_page_number = safe_leaf_page_number;
 
-		if( libfdata_vector_get_element_value_by_index(
+		if( libesedb_page_get_from_pages_vector(
 		     page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) page_tree->pages_cache,
-		     (int) safe_leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		     file_io_handle,
+		     page_tree->pages_cache,
+		     page_tree->io_handle,
+		     safe_leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1482,21 +1485,29 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
 	return( 1 );
 }
 
-/* Determines the number of leaf values
+/* Reads the leaf page descriptors of the leaf pages up to and including the leaf page
+ * that contains a specific leaf value
+ * The leaf pages are read in order by following the next page numbers, starting
+ * where a previous call stopped, so that the leaf page descriptors tree is built
+ * incrementally instead of by reading all the leaf pages at once
+ * Use INT_MAX as leaf value index to read all the leaf pages
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_number_of_leaf_values(
+int libesedb_page_tree_read_leaf_page_descriptors(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     int *number_of_leaf_values,
+     int leaf_value_index,
+     int *number_of_read_leaf_values,
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *upper_node                               = NULL;
 	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
 	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
 	libesedb_page_t *page                                          = NULL;
-	static char *function                                          = "libesedb_page_tree_get_number_of_leaf_values";
+	static char *function                                          = "libesedb_page_tree_read_leaf_page_descriptors";
 	uint32_t leaf_page_number                                      = 0;
+	uint32_t next_leaf_page_number                                 = 0;
+	int result                                                     = 0;
 	int safe_number_of_leaf_values                                 = 0;
 	int value_index                                                = 0;
 
@@ -1511,21 +1522,51 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 		return( -1 );
 	}
-	if( number_of_leaf_values == NULL )
+	if( leaf_value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid leaf value index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_leaf_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of leaf values.",
+		 "%s: invalid number of read leaf values.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_tree->number_of_leaf_values == -1 )
+	if( ( page_tree->number_of_read_leaf_values == -1 )
+	 && ( page_tree->io_handle != NULL )
+	 && ( page_tree->io_handle->sidecar != NULL ) )
 	{
-		page_tree->number_of_leaf_values = 0;
+		result = libesedb_page_tree_read_leaf_page_descriptors_from_sidecar(
+		          page_tree,
+		          page_tree->io_handle->sidecar,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read leaf page descriptors from sidecar.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( page_tree->number_of_read_leaf_values == -1 )
+	{
 		if( libesedb_page_tree_get_get_first_leaf_page_number(
 		     page_tree,
 		     file_io_handle,
@@ -1541,99 +1582,119 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 			goto on_error;
 		}
-		while( leaf_page_number != 0 )
+		page_tree->next_leaf_page_number      = leaf_page_number;
+		page_tree->number_of_read_leaf_values = 0;
+
+		if( leaf_page_number == 0 )
 		{
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) leaf_page_number - 1,
-			     (intptr_t **) &page,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
+			page_tree->number_of_leaf_values = 0;
+		}
+	}
+	/* The state of the page tree is only updated after a leaf page descriptor
+	 * was successfully inserted so that a failed read can be retried
+	 */
+	while( ( page_tree->next_leaf_page_number != 0 )
+	    && ( page_tree->number_of_read_leaf_values <= leaf_value_index ) )
+	{
+		leaf_page_number           = page_tree->next_leaf_page_number;
+		safe_number_of_leaf_values = page_tree->number_of_read_leaf_values;
 
-				goto on_error;
-			}
-			if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
-			     page_tree,
-			     page,
-			     &safe_number_of_leaf_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
+		if( libesedb_page_get_from_pages_vector(
+		     page_tree->pages_vector,
+		     file_io_handle,
+		     page_tree->pages_cache,
+		     page_tree->io_handle,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
 
-				goto on_error;
-			}
-			if( libesedb_leaf_page_descriptor_initialize(
-			     &leaf_page_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create leaf page descriptor.",
-				 function );
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
+		     page_tree,
+		     page,
+		     &safe_number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
 
-				goto on_error;
-			}
-			leaf_page_descriptor->page_number            = page->page_number;
-			leaf_page_descriptor->first_leaf_value_index = page_tree->number_of_leaf_values;
-			leaf_page_descriptor->last_leaf_value_index  = safe_number_of_leaf_values - 1;
+			goto on_error;
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &next_leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
 
-			if( libcdata_btree_insert_value(
-			     page_tree->leaf_page_descriptors_tree,
-			     &value_index,
-			     (intptr_t *) leaf_page_descriptor,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
-			     &upper_node,
-			     (intptr_t **) &existing_leaf_page_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable insert leaf page descriptor into tree.",
-				 function );
+			goto on_error;
+		}
+		if( libesedb_leaf_page_descriptor_initialize(
+		     &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf page descriptor.",
+			 function );
 
-				goto on_error;
-			}
-			leaf_page_descriptor = NULL;
+			goto on_error;
+		}
+		leaf_page_descriptor->page_number            = leaf_page_number;
+		leaf_page_descriptor->first_leaf_value_index = page_tree->number_of_read_leaf_values;
+		leaf_page_descriptor->last_leaf_value_index  = safe_number_of_leaf_values - 1;
+
+		if( libcdata_btree_insert_value(
+		     page_tree->leaf_page_descriptors_tree,
+		     &value_index,
+		     (intptr_t *) leaf_page_descriptor,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
+		     &upper_node,
+		     (intptr_t **) &existing_leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable insert leaf page descriptor into tree.",
+			 function );
 
-			if( libesedb_page_get_next_page_number(
-			     page,
-			     &leaf_page_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
+			goto on_error;
+		}
+		leaf_page_descriptor = NULL;
 
-				goto on_error;
-			}
+		page_tree->next_leaf_page_number      = next_leaf_page_number;
+		page_tree->number_of_read_leaf_values = safe_number_of_leaf_values;
+
+		if( next_leaf_page_number == 0 )
+		{
 			page_tree->number_of_leaf_values = safe_number_of_leaf_values;
 		}
 	}
-	*number_of_leaf_values = page_tree->number_of_leaf_values;
+	*number_of_read_leaf_values = page_tree->number_of_read_leaf_values;
 
 	return( 1 );
 
@@ -1647,30 +1708,32 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
- * Returns 1 if successful or -1 on error
+/* Reads the leaf page descriptors from a sidecar
+ * The leaf page descriptors are only used when they describe consecutive leaf values
+ * Returns 1 if successful, 0 if the sidecar does not contain usable leaf page descriptors or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index_from_page(
+int libesedb_page_tree_read_leaf_page_descriptors_from_sidecar(
      libesedb_page_tree_t *page_tree,
-     libbfio_handle_t *file_io_handle,
-     libesedb_page_t *page,
-     int leaf_value_index,
-     libesedb_data_definition_t **data_definition,
-     int *current_leaf_value_index,
-     int recursion_depth,
+     libesedb_sidecar_t *sidecar,
      libcerror_error_t **error )
 {
-	libesedb_page_t *child_page                 = NULL;
-	libesedb_page_tree_value_t *page_tree_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
-	uint32_t child_page_number                  = 0;
-	uint32_t page_flags                         = 0;
-	uint16_t data_offset                        = 0;
-	uint16_t number_of_page_values              = 0;
-	uint16_t page_value_index                   = 0;
+	libcdata_tree_node_t *upper_node                               = NULL;
+	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
+	const uint8_t *entries_data                                    = NULL;
+	const uint8_t *entry_data                                      = NULL;
+	static char *function                                          = "libesedb_page_tree_read_leaf_page_descriptors_from_sidecar";
+	size_t entries_data_offset                                     = 0;
+	size_t entries_data_size                                       = 0;
+	size_t entry_data_size                                         = 0;
+	uint32_t entry_index                                           = 0;
+	uint32_t number_of_entries                                     = 0;
+	uint32_t page_number                                           = 0;
+	int first_leaf_value_index                                     = 0;
+	int last_leaf_value_index                                      = 0;
+	int number_of_leaf_values                                      = 0;
+	int result                                                     = 0;
+	int value_index                                                = 0;
 
 	if( page_tree == NULL )
 	{
@@ -1683,396 +1746,3454 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 		return( -1 );
 	}
-	if( page_tree->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page tree - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( data_definition == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
-		 function );
-
-		return( -1 );
-	}
-	if( current_leaf_value_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current leaf value index.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	if( page_tree->number_of_read_leaf_values != -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree - leaf page descriptors already read.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_page_get_number_of_values(
-	     page,
-	     &number_of_page_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page values.",
-		 function );
+	result = libesedb_sidecar_get_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	          page_tree->root_page_number,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          error );
 
-		goto on_error;
-	}
-	if( number_of_page_values == 0 )
-	{
-		return( 1 );
-	}
-	if( libesedb_page_get_flags(
-	     page,
-	     &page_flags,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page flags.",
+		 "%s: unable to retrieve leaf page descriptors section from sidecar.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	for( page_value_index = 1;
-	     page_value_index < number_of_page_values;
-	     page_value_index++ )
+	/* Validate all the leaf page descriptors before inserting them into the tree
+	 * so that an inconsistent section is ignored instead of partially used
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		if( libesedb_page_get_value_by_index(
-		     page,
-		     page_value_index,
-		     &page_value,
+		if( libesedb_sidecar_get_next_entry(
+		     entries_data,
+		     entries_data_size,
+		     &entries_data_offset,
+		     &entry_data,
+		     &entry_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 "%s: unable to retrieve sidecar entry: %" PRIu32 ".",
 			 function,
-			 page_value_index );
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( page_value == NULL )
+		if( entry_data_size != sizeof( esedb_sidecar_leaf_page_descriptor_t ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->page_number,
+		 page_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->first_leaf_value_index,
+		 first_leaf_value_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->last_leaf_value_index,
+		 last_leaf_value_index );
+
+		if( ( page_number == 0 )
+		 || ( first_leaf_value_index != number_of_leaf_values )
+		 || ( last_leaf_value_index < ( first_leaf_value_index - 1 ) )
+		 || ( last_leaf_value_index == INT_MAX ) )
+		{
+			return( 0 );
+		}
+		number_of_leaf_values = last_leaf_value_index + 1;
+	}
+	entries_data_offset = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libesedb_sidecar_get_next_entry(
+		     entries_data,
+		     entries_data_size,
+		     &entries_data_offset,
+		     &entry_data,
+		     &entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sidecar entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_leaf_page_descriptor_initialize(
+		     &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf page descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->page_number,
+		 leaf_page_descriptor->page_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->first_leaf_value_index,
+		 leaf_page_descriptor->first_leaf_value_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->last_leaf_value_index,
+		 leaf_page_descriptor->last_leaf_value_index );
+
+		if( libcdata_btree_insert_value(
+		     page_tree->leaf_page_descriptors_tree,
+		     &value_index,
+		     (intptr_t *) leaf_page_descriptor,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
+		     &upper_node,
+		     (intptr_t **) &existing_leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable insert leaf page descriptor into tree.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptor = NULL;
+	}
+	page_tree->next_leaf_page_number      = 0;
+	page_tree->number_of_read_leaf_values = number_of_leaf_values;
+	page_tree->number_of_leaf_values      = number_of_leaf_values;
+
+	return( 1 );
+
+on_error:
+	if( leaf_page_descriptor != NULL )
+	{
+		libesedb_leaf_page_descriptor_free(
+		 &leaf_page_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the leaf page descriptors to a sidecar
+ * All the leaf pages are read if this has not been done before
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_append_leaf_page_descriptors_to_sidecar(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ sizeof( esedb_sidecar_leaf_page_descriptor_t ) ];
+
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor = NULL;
+	static char *function                                 = "libesedb_page_tree_append_leaf_page_descriptors_to_sidecar";
+	int number_of_descriptors                             = 0;
+	int number_of_leaf_values                             = 0;
+	int value_index                                       = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     page_tree,
+	     file_io_handle,
+	     &number_of_leaf_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_get_number_of_values(
+	     page_tree->leaf_page_descriptors_tree,
+	     &number_of_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf page descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_sidecar_append_section(
+	     sidecar,
+	     LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	     page_tree->root_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append leaf page descriptors section to sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	/* The leaf page descriptors are stored in the tree in the order they were read
+	 */
+	for( value_index = 0;
+	     value_index < number_of_descriptors;
+	     value_index++ )
+	{
+		if( libcdata_btree_get_value_by_index(
+		     page_tree->leaf_page_descriptors_tree,
+		     value_index,
+		     (intptr_t **) &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page descriptor: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( leaf_page_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing leaf page descriptor: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->page_number,
+		 leaf_page_descriptor->page_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->first_leaf_value_index,
+		 leaf_page_descriptor->first_leaf_value_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_sidecar_leaf_page_descriptor_t *) entry_data )->last_leaf_value_index,
+		 leaf_page_descriptor->last_leaf_value_index );
+
+		if( libesedb_sidecar_append_entry(
+		     sidecar,
+		     entry_data,
+		     sizeof( esedb_sidecar_leaf_page_descriptor_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf page descriptor: %d to sidecar.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the number of leaf values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_page_tree_get_number_of_leaf_values";
+	int safe_number_of_leaf_values = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->number_of_leaf_values == -1 )
+	{
+		if( libesedb_page_tree_read_leaf_page_descriptors(
+		     page_tree,
+		     file_io_handle,
+		     INT_MAX,
+		     &safe_number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read leaf page descriptors.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_leaf_values = page_tree->number_of_leaf_values;
+
+	return( 1 );
+}
+
+/* Determines the estimated number of leaf pages and the number of leaf values of the first leaf page from a page
+ * Only the first path to a leaf page is read, the number of leaf pages is estimated
+ * by multiplying the number of (non-defunct) child pages of the branch pages on this path
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     uint64_t *number_of_leaf_pages,
+     int *number_of_leaf_values,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *child_page                 = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page";
+	uint64_t number_of_child_leaf_pages         = 0;
+	uint32_t child_page_number                  = 0;
+	uint32_t page_flags                         = 0;
+	uint16_t number_of_child_pages              = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		*number_of_leaf_values = 0;
+
+		if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
+		     page_tree,
+		     page,
+		     number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		*number_of_leaf_pages = 1;
+
+		return( 1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		number_of_child_pages++;
+
+		if( child_page_number != 0 )
+		{
+			continue;
+		}
+		if( libesedb_page_tree_value_initialize(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_read_data(
+		     page_tree_value,
+		     page_value->data,
+		     (size_t) page_value->size,
+		     page_value->flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_tree_value->data_size < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_tree_value->data,
+		 child_page_number );
+
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+#if ( SIZEOF_INT <= 4 )
+		if( ( child_page_number < 1 )
+		 || ( child_page_number > (uint32_t) INT_MAX )
+		 || ( child_page_number > page_tree->io_handle->last_page_number ) )
+#else
+		if( ( child_page_number < 1 )
+		 || ( (int) child_page_number > INT_MAX )
+		 || ( child_page_number > page_tree->io_handle->last_page_number ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid child page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*number_of_leaf_pages  = 0;
+	*number_of_leaf_values = 0;
+
+	if( child_page_number == 0 )
+	{
+		return( 1 );
+	}
+	/* The page is no longer used after the child page has been retrieved
+	 * since it could be removed from the pages cache
+	 */
+	if( libesedb_page_get_from_pages_vector(
+	     page_tree->pages_vector,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     child_page_number,
+	     &child_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 child_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_validate_page(
+	     child_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page(
+	     page_tree,
+	     file_io_handle,
+	     child_page,
+	     &number_of_child_leaf_pages,
+	     number_of_leaf_values,
+	     recursion_depth + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve estimated number of leaf pages from page: %" PRIu32 ".",
+		 function,
+		 child_page_number );
+
+		goto on_error;
+	}
+	/* The recursion depth limits the number of multiplications so this cannot overflow
+	 * unless the page tree is corrupted in which case the estimate is capped
+	 */
+	if( number_of_child_leaf_pages > ( UINT64_MAX / number_of_child_pages ) )
+	{
+		*number_of_leaf_pages = UINT64_MAX;
+	}
+	else
+	{
+		*number_of_leaf_pages = number_of_child_leaf_pages * number_of_child_pages;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the number of pages owned by the page tree
+ * The number of owned pages is determined from the root page header and
+ * the owned pages space tree, without reading the leaf pages of the page tree
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_page_tree_get_number_of_owned_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_owned_pages,
+     libcerror_error_t **error )
+{
+	libesedb_space_tree_t *space_tree = NULL;
+	static char *function             = "libesedb_page_tree_get_number_of_owned_pages";
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_owned_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of owned pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->root_page_header == NULL )
+	{
+		return( 0 );
+	}
+	/* A page tree without extent space consists of a single extent
+	 */
+	if( page_tree->root_page_header->extent_space == 0 )
+	{
+		if( page_tree->root_page_header->initial_number_of_pages == 0 )
+		{
+			return( 0 );
+		}
+		*number_of_owned_pages = (uint64_t) page_tree->root_page_header->initial_number_of_pages;
+
+		return( 1 );
+	}
+	if( ( page_tree->root_page_header->space_tree_page_number == 0 )
+	 || ( page_tree->root_page_header->space_tree_page_number >= 0xff000000UL )
+	 || ( page_tree->root_page_header->space_tree_page_number > page_tree->io_handle->last_page_number ) )
+	{
+		return( 0 );
+	}
+	if( libesedb_space_tree_initialize(
+	     &space_tree,
+	     page_tree->io_handle,
+	     page_tree->object_identifier,
+	     page_tree->root_page_header->space_tree_page_number,
+	     page_tree->pages_vector,
+	     page_tree->pages_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create owned pages space tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_space_tree_read_file_io_handle(
+	     space_tree,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read owned pages space tree.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_owned_pages = space_tree->number_of_pages;
+
+	if( libesedb_space_tree_free(
+	     &space_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free space tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( *number_of_owned_pages == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( space_tree != NULL )
+	{
+		libesedb_space_tree_free(
+		 &space_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the estimated number of leaf values
+ * The estimate is determined from the fan-out of the branch pages on the first path
+ * from the root page to a leaf page and the number of leaf values of that leaf page.
+ * The estimated number of leaf pages is limited by the number of pages owned by the page tree.
+ * Only a few pages are read, where the number of leaf values is exact if all the leaf pages
+ * have already been read or if the root page is a leaf page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_estimated_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *root_page           = NULL;
+	static char *function                = "libesedb_page_tree_get_estimated_number_of_leaf_values";
+	uint64_t number_of_leaf_pages        = 0;
+	uint64_t number_of_owned_pages       = 0;
+	uint64_t safe_number_of_leaf_values  = 0;
+	uint32_t page_flags                  = 0;
+	int number_of_first_page_leaf_values = 0;
+	int result                           = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->number_of_leaf_values != -1 )
+	{
+		*number_of_leaf_values = (uint64_t) page_tree->number_of_leaf_values;
+
+		return( 1 );
+	}
+	if( libesedb_page_get_from_pages_vector(
+	     page_tree->pages_vector,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     page_tree->root_page_number,
+	     &root_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_flags(
+	     root_page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Seen in temp.edb where is root flag is not set
+	 */
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		if( libesedb_page_validate_root_page(
+		     root_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root page.",
+			 function );
+
+			return( -1 );
+		}
+		if( page_tree->root_page_header == NULL )
+		{
+			if( libesedb_page_tree_read_root_page_header(
+			     page_tree,
+			     root_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read root page header.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page(
+	     page_tree,
+	     file_io_handle,
+	     root_page,
+	     &number_of_leaf_pages,
+	     &number_of_first_page_leaf_values,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve estimated number of leaf pages from root page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		return( -1 );
+	}
+	if( number_of_leaf_pages > 1 )
+	{
+		/* The space tree is only used to improve the estimate
+		 * hence if it cannot be read the estimate is not limited
+		 */
+		result = libesedb_page_tree_get_number_of_owned_pages(
+		          page_tree,
+		          file_io_handle,
+		          &number_of_owned_pages,
+		          error );
+
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( result != 0 )
+		{
+			if( number_of_leaf_pages > number_of_owned_pages )
+			{
+				number_of_leaf_pages = number_of_owned_pages;
+			}
+		}
+	}
+	if( number_of_first_page_leaf_values == 0 )
+	{
+		safe_number_of_leaf_values = 0;
+	}
+	else if( number_of_leaf_pages > ( UINT64_MAX / (uint64_t) number_of_first_page_leaf_values ) )
+	{
+		safe_number_of_leaf_values = UINT64_MAX;
+	}
+	else
+	{
+		safe_number_of_leaf_values = number_of_leaf_pages * (uint64_t) number_of_first_page_leaf_values;
+	}
+	/* The leaf values of the leaf pages that have already been read are an exact lower bound
+	 */
+	if( page_tree->number_of_read_leaf_values > 0 )
+	{
+		if( safe_number_of_leaf_values < (uint64_t) page_tree->number_of_read_leaf_values )
+		{
+			safe_number_of_leaf_values = (uint64_t) page_tree->number_of_read_leaf_values;
+		}
+	}
+	*number_of_leaf_values = safe_number_of_leaf_values;
+
+	return( 1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_index_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     int leaf_value_index,
+     libesedb_data_definition_t **data_definition,
+     int *current_leaf_value_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *child_page                 = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
+	uint32_t child_page_number                  = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t page_number                        = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_page_values == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	page_number = page->page_number;
+
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
+			 function,
+			 page_value_index,
+			 page_value->flags );
+			libesedb_debug_print_page_tag_flags(
+			 page_value->flags );
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			if( *current_leaf_value_index == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid current leaf value index value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( *current_leaf_value_index < leaf_value_index )
+			{
+				*current_leaf_value_index += 1;
+
+				continue;
+			}
+		}
+		if( libesedb_page_tree_value_initialize(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_read_data(
+		     page_tree_value,
+		     page_value->data,
+		     (size_t) page_value->size,
+		     page_value->flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			if( libesedb_data_definition_initialize(
+			     data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data definition.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				data_offset += 2;
+			}
+			( *data_definition )->page_value_index = page_value_index;
+			( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+			( *data_definition )->page_number      = page->page_number;
+			( *data_definition )->data_offset      = data_offset;
+			( *data_definition )->data_size        = page_tree_value->data_size;
+
+			*current_leaf_value_index += 1;
+		}
+		else
+		{
+			if( page_tree_value->data_size < 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 page_tree_value->data,
+			 child_page_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
+				 function,
+				 page_value_index,
+				 child_page_number );
+
+				if( child_page_number == 0 )
+				{
+					libcnotify_printf(
+					 " (invalid page number)\n" );
+				}
+				else if( child_page_number > page_tree->io_handle->last_page_number )
+				{
+					libcnotify_printf(
+					 " (exceeds last page number: %" PRIu32 ")\n",
+					 page_tree->io_handle->last_page_number );
+				}
+				libcnotify_printf(
+				 "\n" );
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+#if ( SIZEOF_INT <= 4 )
+			if( ( child_page_number < 1 )
+			 || ( child_page_number > (uint32_t) INT_MAX ) )
+#else
+			if( ( child_page_number < 1 )
+			 || ( (int) child_page_number > INT_MAX ) )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid child page number value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( page_tree_value->data_size > 4 )
+				{
+					libcnotify_printf(
+					 "%s: page value: %03" PRIu16 " trailing data:\n",
+					 function,
+					 page_value_index );
+					libcnotify_print_data(
+					 &( page_tree_value->data[ 4 ] ),
+					 page_tree_value->data_size - 4,
+					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				}
+			}
+#endif
+			if( ( child_page_number > 0 )
+			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
+			{
+				if( libesedb_page_get_from_pages_vector(
+				     page_tree->pages_vector,
+				     file_io_handle,
+				     page_tree->pages_cache,
+				     page_tree->io_handle,
+				     child_page_number,
+				     &child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
+
+					goto on_error;
+				}
+				if( libesedb_page_validate_page(
+				     child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported page.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+				     page_tree,
+				     file_io_handle,
+				     child_page,
+				     leaf_value_index,
+				     data_definition,
+				     current_leaf_value_index,
+				     recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
+					 function,
+					 leaf_value_index,
+					 child_page_number );
+
+					goto on_error;
+				}
+				/* Reading the child pages can evict the page from the pages cache
+				 */
+				if( *current_leaf_value_index <= leaf_value_index )
+				{
+					if( libesedb_page_get_from_pages_vector(
+					     page_tree->pages_vector,
+					     file_io_handle,
+					     page_tree->pages_cache,
+					     page_tree->io_handle,
+					     page_number,
+					     &page,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve page: %" PRIu32 ".",
+						 function,
+						 page_number );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( *current_leaf_value_index > leaf_value_index )
+		{
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_index(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node                               = NULL;
+	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
+	libesedb_page_t *base_page                                     = NULL;
+	static char *function                                          = "libesedb_page_tree_get_leaf_value_by_index";
+	uint32_t base_page_number                                      = 0;
+	int current_leaf_value_index                                   = 0;
+	int number_of_read_leaf_values                                 = 0;
+	int result                                                     = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf value index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the leaf pages up to the one that contains the leaf value are read
+	 * to build the leaf_page_descriptors_tree
+	 */
+	if( libesedb_page_tree_read_leaf_page_descriptors(
+	     page_tree,
+	     file_io_handle,
+	     leaf_value_index,
+	     &number_of_read_leaf_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read leaf page descriptors from page tree: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		goto on_error;
+	}
+	base_page_number = page_tree->root_page_number;
+
+	if( libesedb_leaf_page_descriptor_initialize(
+	     &leaf_page_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf page descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	leaf_page_descriptor->first_leaf_value_index = leaf_value_index;
+	leaf_page_descriptor->last_leaf_value_index  = leaf_value_index;
+
+	result = libcdata_btree_get_value_by_value(
+	          page_tree->leaf_page_descriptors_tree,
+	          (intptr_t *) leaf_page_descriptor,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_leaf_page_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptor from tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( existing_leaf_page_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing existing leaf page descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		current_leaf_value_index = existing_leaf_page_descriptor->first_leaf_value_index;
+		base_page_number         = existing_leaf_page_descriptor->page_number;
+	}
+	if( libesedb_leaf_page_descriptor_free(
+	     &leaf_page_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free leaf page descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_from_pages_vector(
+	     page_tree->pages_vector,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     base_page_number,
+	     &base_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( base_page_number == page_tree->root_page_number )
+	{
+		if( libesedb_page_validate_root_page(
+		     base_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+	     page_tree,
+	     file_io_handle,
+	     base_page,
+	     leaf_value_index,
+	     data_definition,
+	     &current_leaf_value_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
+		 function,
+		 leaf_value_index,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current leaf value index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( leaf_page_descriptor != NULL )
+	{
+		libesedb_leaf_page_descriptor_free(
+		 &leaf_page_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the leaf value of a specific page value of a leaf page into an existing data definition
+ * The page value index, page offset, page number, data offset and data size
+ * of the data definition are overwritten
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_read_leaf_value_from_leaf_page(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_read_leaf_value_from_leaf_page";
+	uint16_t data_offset                        = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     page_tree_value,
+	     page_value->data,
+	     (size_t) page_value->size,
+	     page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		data_offset += 2;
+	}
+	data_definition->page_value_index = page_value_index;
+	data_definition->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+	data_definition->page_number      = page->page_number;
+	data_definition->data_offset      = data_offset;
+	data_definition->data_size        = page_tree_value->data_size;
+
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the leaf value of a specific page value of a leaf page
+ * This function creates a new data definition
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_from_leaf_page(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_get_leaf_value_from_leaf_page";
+	int result            = 0;
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_initialize(
+	     data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_read_leaf_value_from_leaf_page(
+	          page_tree,
+	          page,
+	          page_value_index,
+	          *data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leaf value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+	}
+	if( result != 1 )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Retrieves the leaf page descriptors from a page
+ * The leaf page numbers are determined from the branch pages, where only the first path
+ * to a leaf page is read to determine the depth of the leaf pages in the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_page_descriptors_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     libcdata_array_t *leaf_page_descriptors_array,
+     int *leaf_page_depth,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor = NULL;
+	libesedb_page_t *child_page                           = NULL;
+	libesedb_page_tree_value_t *page_tree_value           = NULL;
+	libesedb_page_value_t *page_value                     = NULL;
+	static char *function                                 = "libesedb_page_tree_get_leaf_page_descriptors_from_page";
+	uint32_t child_page_number                            = 0;
+	uint32_t page_flags                                   = 0;
+	uint16_t number_of_page_values                        = 0;
+	uint16_t page_value_index                             = 0;
+	int entry_index                                       = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page depth.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		if( *leaf_page_depth == -1 )
+		{
+			*leaf_page_depth = recursion_depth;
+		}
+		else if( *leaf_page_depth != recursion_depth )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page: %" PRIu32 " depth value out of bounds.",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		if( libesedb_leaf_page_descriptor_initialize(
+		     &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf page descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptor->page_number            = page->page_number;
+		leaf_page_descriptor->first_leaf_value_index = -1;
+		leaf_page_descriptor->last_leaf_value_index  = -1;
+
+		if( libcdata_array_append_entry(
+		     leaf_page_descriptors_array,
+		     &entry_index,
+		     (intptr_t *) leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf page descriptor to array.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_page_descriptor = NULL;
+
+		return( 1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( page_tree->io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		if( libesedb_page_tree_value_initialize(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_read_data(
+		     page_tree_value,
+		     page_value->data,
+		     (size_t) page_value->size,
+		     page_value->flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_tree_value->data_size < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_tree_value->data,
+		 child_page_number );
+
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+#if ( SIZEOF_INT <= 4 )
+		if( ( child_page_number < 1 )
+		 || ( child_page_number > page_tree->io_handle->last_page_number )
+		 || ( child_page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( child_page_number < 1 )
+		 || ( child_page_number > page_tree->io_handle->last_page_number )
+		 || ( (int) child_page_number > INT_MAX ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid child page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Once the depth of the leaf pages is known the child pages of the pages directly
+		 * above the leaf pages do not need to be read
+		 */
+		if( ( *leaf_page_depth != -1 )
+		 && ( ( recursion_depth + 1 ) >= *leaf_page_depth ) )
+		{
+			if( ( recursion_depth + 1 ) != *leaf_page_depth )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page: %" PRIu32 " depth value out of bounds.",
+				 function,
+				 page->page_number );
+
+				goto on_error;
+			}
+			if( libesedb_leaf_page_descriptor_initialize(
+			     &leaf_page_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create leaf page descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			leaf_page_descriptor->page_number            = child_page_number;
+			leaf_page_descriptor->first_leaf_value_index = -1;
+			leaf_page_descriptor->last_leaf_value_index  = -1;
+
+			if( libcdata_array_append_entry(
+			     leaf_page_descriptors_array,
+			     &entry_index,
+			     (intptr_t *) leaf_page_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append leaf page descriptor to array.",
+				 function );
+
+				goto on_error;
+			}
+			leaf_page_descriptor = NULL;
+
+			continue;
+		}
+		if( libesedb_page_get_from_pages_vector(
+		     page_tree->pages_vector,
+		     file_io_handle,
+		     page_tree->pages_cache,
+		     page_tree->io_handle,
+		     child_page_number,
+		     &child_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_validate_page(
+		     child_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_leaf_page_descriptors_from_page(
+		     page_tree,
+		     file_io_handle,
+		     child_page,
+		     leaf_page_descriptors_array,
+		     leaf_page_depth,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page descriptors from page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( leaf_page_descriptor != NULL )
+	{
+		libesedb_leaf_page_descriptor_free(
+		 &leaf_page_descriptor,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the leaf page descriptors
+ * The leaf page descriptors are appended to the array in key order,
+ * only their page number is set
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *leaf_page_descriptors_array,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_page_tree_get_leaf_page_descriptors";
+	uint32_t page_flags   = 0;
+	int leaf_page_depth   = -1;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_from_pages_vector(
+	     page_tree->pages_vector,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     page_tree->root_page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Seen in temp.edb where is root flag is not set
+	 */
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		if( libesedb_page_validate_root_page(
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_page_tree_get_leaf_page_descriptors_from_page(
+	     page_tree,
+	     file_io_handle,
+	     page,
+	     leaf_page_descriptors_array,
+	     &leaf_page_depth,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptors from page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of a specific page value
+ * This function creates a page tree value and a key
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_get_key_of_page_value(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_value_t **page_value,
+     libesedb_page_tree_value_t **page_tree_value,
+     libesedb_page_tree_key_t **key,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *safe_key               = NULL;
+	libesedb_page_tree_value_t *safe_page_tree_value = NULL;
+	libesedb_page_value_t *safe_page_value           = NULL;
+	static char *function                            = "libesedb_page_tree_get_key_of_page_value";
+
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     page_value_index,
+	     &safe_page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( safe_page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
+		 function,
+		 page_value_index,
+		 safe_page_value->flags );
+		libesedb_debug_print_page_tag_flags(
+		 safe_page_value->flags );
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( safe_page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		if( ( safe_page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page - root flag is set and page value: %" PRIu16 " has common key.",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &safe_page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     safe_page_tree_value,
+	     safe_page_value->data,
+	     (size_t) safe_page_value->size,
+	     safe_page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_key(
+	     page_tree,
+	     safe_page_tree_value,
+	     page,
+	     page_flags,
+	     page_value_index,
+	     &safe_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	*page_value      = safe_page_value;
+	*page_tree_value = safe_page_tree_value;
+	*key             = safe_key;
+
+	return( 1 );
+
+on_error:
+	if( safe_page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &safe_page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares a key with the key of a specific page value
+ * This function creates a page tree value
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_tree_compare_key_with_page_value(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_tree_key_t *key,
+     libesedb_page_value_t **page_value,
+     libesedb_page_tree_value_t **page_tree_value,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *page_value_key         = NULL;
+	libesedb_page_tree_value_t *safe_page_tree_value = NULL;
+	libesedb_page_value_t *safe_page_value           = NULL;
+	static char *function                            = "libesedb_page_tree_compare_key_with_page_value";
+	int result                                       = 0;
+	int safe_compare_result                          = 0;
+
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_tree_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page tree value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_key_of_page_value(
+	          page_tree,
+	          page,
+	          page_flags,
+	          page_value_index,
+	          &safe_page_value,
+	          &safe_page_tree_value,
+	          &page_value_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	safe_compare_result = libesedb_page_tree_key_compare(
+	                       key,
+	                       page_value_key,
+	                       error );
+
+	if( safe_compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare page value: %" PRIu16 " and leaf value keys.",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_key_free(
+	     &page_value_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page value key.",
+		 function );
+
+		goto on_error;
+	}
+	*page_value      = safe_page_value;
+	*page_tree_value = safe_page_tree_value;
+	*compare_result  = safe_compare_result;
+
+	return( 1 );
+
+on_error:
+	if( page_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_value_key,
+		 NULL );
+	}
+	if( safe_page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &safe_page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the index of the first page value with a key that is not less than a specific key
+ * The page values are searched using a binary search, where only the keys of the probed page values are determined
+ * The page value index is set to the number of page values if no such page value exists
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_first_page_value_index_by_key(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t number_of_page_values,
+     libesedb_page_tree_key_t *key,
+     uint16_t *page_value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_first_page_value_index_by_key";
+	uint16_t high_page_value_index              = 0;
+	uint16_t low_page_value_index               = 0;
+	uint16_t middle_page_value_index            = 0;
+	uint16_t probe_page_value_index             = 0;
+	int compare_result                          = 0;
+	int result                                  = 0;
+
+	if( page_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Page value 0 contains the page header or common key and is not part of the search
+	 */
+	low_page_value_index  = 1;
+	high_page_value_index = number_of_page_values;
+
+	while( low_page_value_index < high_page_value_index )
+	{
+		middle_page_value_index = low_page_value_index + ( ( high_page_value_index - low_page_value_index ) / 2 );
+
+		/* Defunct page values have no key and are skipped
+		 */
+		for( probe_page_value_index = middle_page_value_index;
+		     probe_page_value_index < high_page_value_index;
+		     probe_page_value_index++ )
+		{
+			result = libesedb_page_tree_compare_key_with_page_value(
+			          page_tree,
+			          page,
+			          page_flags,
+			          probe_page_value_index,
+			          key,
+			          &page_value,
+			          &page_tree_value,
+			          &compare_result,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key with page value: %" PRIu16 ".",
+				 function,
+				 probe_page_value_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( probe_page_value_index >= high_page_value_index )
+		{
+			high_page_value_index = middle_page_value_index;
+
+			continue;
+		}
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			low_page_value_index = probe_page_value_index + 1;
+		}
+		else
+		{
+			high_page_value_index = probe_page_value_index;
+		}
+	}
+	/* The search can end on a defunct page value when all page values up to
+	 * the next candidate are defunct
+	 */
+	while( low_page_value_index < number_of_page_values )
+	{
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     low_page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 low_page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 low_page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			break;
+		}
+		low_page_value_index++;
+	}
+	*page_value_index = low_page_value_index;
+
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value from a specific page value
+ * This function creates a new data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_key_from_page_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_tree_key_t *leaf_value_key,
+     libesedb_data_definition_t **data_definition,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *child_page                 = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_leaf_value_by_key_from_page_value";
+	uint32_t child_page_number                  = 0;
+	uint16_t data_offset                        = 0;
+	int compare_result                          = 0;
+	int result                                  = 0;
+
+	result = libesedb_page_tree_compare_key_with_page_value(
+	          page_tree,
+	          page,
+	          page_flags,
+	          page_value_index,
+	          leaf_value_key,
+	          &page_value,
+	          &page_tree_value,
+	          &compare_result,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare leaf value key with page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = 0;
+
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		if( compare_result == LIBFDATA_COMPARE_EQUAL )
+		{
+			if( libesedb_data_definition_initialize(
+			     data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data definition.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				data_offset += 2;
+			}
+			( *data_definition )->page_value_index = page_value_index;
+			( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+			( *data_definition )->page_number      = page->page_number;
+			( *data_definition )->data_offset      = data_offset;
+			( *data_definition )->data_size        = page_tree_value->data_size;
+
+			result = 1;
+		}
+	}
+	else if( compare_result != LIBFDATA_COMPARE_GREATER )
+	{
+		if( page_tree_value->data_size < 4 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing page value: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
 			 function,
 			 page_value_index );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
-			 function,
-			 page_value_index,
-			 page_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_value->flags );
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
-		{
-			continue;
-		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_tree_value->data,
+		 child_page_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
+			 function,
+			 page_value_index,
+			 child_page_number );
+
+			if( child_page_number == 0 )
+			{
+				libcnotify_printf(
+				 " (invalid page number)\n" );
+			}
+			else if( child_page_number > page_tree->io_handle->last_page_number )
+			{
+				libcnotify_printf(
+				 " (exceeds last page number: %" PRIu32 ")\n",
+				 page_tree->io_handle->last_page_number );
+			}
+			libcnotify_printf(
+			 "\n" );
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+#if ( SIZEOF_INT <= 4 )
+		if( ( child_page_number < 1 )
+		 || ( child_page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( child_page_number < 1 )
+		 || ( (int) child_page_number > INT_MAX ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid child page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( page_tree_value->data_size > 4 )
+			{
+				libcnotify_printf(
+				 "%s: page value: %03" PRIu16 " trailing data:\n",
+				 function,
+				 page_value_index );
+				libcnotify_print_data(
+				 &( page_tree_value->data[ 4 ] ),
+				 page_tree_value->data_size - 4,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+		}
+#endif
+		if( ( child_page_number > 0 )
+		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
+		{
+			if( libesedb_page_get_from_pages_vector(
+			     page_tree->pages_vector,
+			     file_io_handle,
+			     page_tree->pages_cache,
+			     page_tree->io_handle,
+			     child_page_number,
+			     &child_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 child_page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_validate_page(
+			     child_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page.",
+				 function );
+
+				goto on_error;
+			}
+			result = libesedb_page_tree_get_leaf_value_by_key_from_page(
+			          page_tree,
+			          file_io_handle,
+			          child_page,
+			          leaf_value_key,
+			          data_definition,
+			          recursion_depth + 1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
+				 function,
+				 child_page_number );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_key_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     libesedb_page_tree_key_t *leaf_value_key,
+     libesedb_data_definition_t **data_definition,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function           = "libesedb_page_tree_get_leaf_value_by_key_from_page";
+	uint32_t page_flags             = 0;
+	uint32_t page_number            = 0;
+	uint16_t first_page_value_index = 0;
+	uint16_t number_of_page_values  = 0;
+	uint16_t page_value_index       = 0;
+	int result                      = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf value key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_page_values == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_first_page_value_index_by_key(
+	     page_tree,
+	     page,
+	     page_flags,
+	     number_of_page_values,
+	     leaf_value_key,
+	     &first_page_value_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine first page value index by key.",
+		 function );
+
+		goto on_error;
+	}
+	page_number = page->page_number;
+
+	/* The long value and long value segment keys are strictly ordered, hence only the first
+	 * page value with a key that is not less than the leaf value key can contain the leaf value.
+	 * Index value keys can match a leaf key flexibly, hence the remaining page values are
+	 * searched as well if the leaf value was not found.
+	 */
+	for( page_value_index = first_page_value_index;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		/* Reading the child pages of the previous page value can evict the page
+		 * from the pages cache
+		 */
+		if( ( page_value_index > first_page_value_index )
+		 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 ) )
 		{
-			if( *current_leaf_value_index == INT_MAX )
+			if( libesedb_page_get_from_pages_vector(
+			     page_tree->pages_vector,
+			     file_io_handle,
+			     page_tree->pages_cache,
+			     page_tree->io_handle,
+			     page_number,
+			     &page,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid current leaf value index value out of bounds.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 page_number );
 
 				goto on_error;
 			}
-			if( *current_leaf_value_index < leaf_value_index )
-			{
-				*current_leaf_value_index += 1;
-
-				continue;
-			}
 		}
-		if( libesedb_page_tree_value_initialize(
-		     &page_tree_value,
-		     error ) != 1 )
+		result = libesedb_page_tree_get_leaf_value_by_key_from_page_value(
+		          page_tree,
+		          file_io_handle,
+		          page,
+		          page_flags,
+		          page_value_index,
+		          leaf_value_key,
+		          data_definition,
+		          recursion_depth,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tree value.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_page_tree_value_read_data(
-		     page_tree_value,
-		     page_value->data,
-		     (size_t) page_value->size,
-		     page_value->flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value from page value: %" PRIu16 ".",
 			 function,
 			 page_value_index );
 
 			goto on_error;
 		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		else if( result != 0 )
 		{
-			if( libesedb_data_definition_initialize(
-			     data_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create data definition.",
-				 function );
-
-				goto on_error;
-			}
-			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
-
-			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
-			{
-				data_offset += 2;
-			}
-			( *data_definition )->page_value_index = page_value_index;
-			( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
-			( *data_definition )->page_number      = page->page_number;
-			( *data_definition )->data_offset      = data_offset;
-			( *data_definition )->data_size        = page_tree_value->data_size;
-
-			*current_leaf_value_index += 1;
+			break;
 		}
-		else
+		if( leaf_value_key->type != LIBESEDB_KEY_TYPE_INDEX_VALUE )
 		{
-			if( page_tree_value->data_size < 4 )
+			break;
+		}
+	}
+	if( ( result == 0 )
+	 && ( leaf_value_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+	 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 ) )
+	{
+		for( page_value_index = 1;
+		     page_value_index < first_page_value_index;
+		     page_value_index++ )
+		{
+			result = libesedb_page_tree_get_leaf_value_by_key_from_page_value(
+			          page_tree,
+			          file_io_handle,
+			          page,
+			          page_flags,
+			          page_value_index,
+			          leaf_value_key,
+			          data_definition,
+			          recursion_depth,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value from page value: %" PRIu16 ".",
 				 function,
 				 page_value_index );
 
 				goto on_error;
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 page_tree_value->data,
-			 child_page_number );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
-				 function,
-				 page_value_index,
-				 child_page_number );
-
-				if( child_page_number == 0 )
-				{
-					libcnotify_printf(
-					 " (invalid page number)\n" );
-				}
-				else if( child_page_number > page_tree->io_handle->last_page_number )
-				{
-					libcnotify_printf(
-					 " (exceeds last page number: %" PRIu32 ")\n",
-					 page_tree->io_handle->last_page_number );
-				}
-				libcnotify_printf(
-				 "\n" );
-				libcnotify_printf(
-				 "\n" );
-			}
-#endif
-#if ( SIZEOF_INT <= 4 )
-			if( ( child_page_number < 1 )
-			 || ( child_page_number > (uint32_t) INT_MAX ) )
-#else
-			if( ( child_page_number < 1 )
-			 || ( (int) child_page_number > INT_MAX ) )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid child page number value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( page_tree_value->data_size > 4 )
-				{
-					libcnotify_printf(
-					 "%s: page value: %03" PRIu16 " trailing data:\n",
-					 function,
-					 page_value_index );
-					libcnotify_print_data(
-					 &( page_tree_value->data[ 4 ] ),
-					 page_tree_value->data_size - 4,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
-			}
-#endif
-			if( ( child_page_number > 0 )
-			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
+			else if( result != 0 )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve page: %" PRIu32 ".",
-					 function,
-					 child_page_number );
-
-					goto on_error;
-				}
-				if( libesedb_page_validate_page(
-				     child_page,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported page.",
-					 function );
-
-					goto on_error;
-				}
-				if( libesedb_page_tree_get_leaf_value_by_index_from_page(
-				     page_tree,
-				     file_io_handle,
-				     child_page,
-				     leaf_value_index,
-				     data_definition,
-				     current_leaf_value_index,
-				     recursion_depth + 1,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
-					 function,
-					 leaf_value_index,
-					 child_page_number );
-
-					goto on_error;
-				}
+				break;
 			}
 		}
-		if( libesedb_page_tree_value_free(
-		     &page_tree_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page tree value.",
-			 function );
-
-			goto on_error;
-		}
-		if( *current_leaf_value_index > leaf_value_index )
-		{
-			break;
-		}
-	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
-		 function );
-
-		goto on_error;
 	}
-	return( 1 );
+	return( result );
 
 on_error:
 	if( *data_definition != NULL )
@@ -2081,42 +5202,23 @@ on_error:
 		 data_definition,
 		 NULL );
 	}
-	if( page_tree_value != NULL )
-	{
-		libesedb_page_tree_value_free(
-		 &page_tree_value,
-		 NULL );
-	}
-	if( child_page_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &child_page_cache,
-		 NULL );
-	}
 	return( -1 );
 }
 
 /* Retrieves a specific leaf value
  * This function creates a new data definition
- * Returns 1 if successful or -1 on error
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index(
+int libesedb_page_tree_get_leaf_value_by_key(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     int leaf_value_index,
+     libesedb_page_tree_key_t *leaf_value_key,
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node                               = NULL;
-	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
-	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
-	libesedb_page_t *base_page                                     = NULL;
-	libfcache_cache_t *base_page_cache                             = NULL;
-	static char *function                                          = "libesedb_page_tree_get_leaf_value_by_index";
-	uint32_t base_page_number                                      = 0;
-	int current_leaf_value_index                                   = 0;
-	int number_of_leaf_values                                      = 0;
-	int result                                                     = 0;
+	libesedb_page_t *root_page = NULL;
+	static char *function      = "libesedb_page_tree_get_leaf_value_by_key";
+	int result                 = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2129,261 +5231,321 @@ int libesedb_page_tree_get_leaf_value_by_index(
 
 		return( -1 );
 	}
-	if( leaf_value_index < 0 )
+	if( libesedb_page_get_from_pages_vector(
+	     page_tree->pages_vector,
+	     file_io_handle,
+	     page_tree->pages_cache,
+	     page_tree->io_handle,
+	     page_tree->root_page_number,
+	     &root_page,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid leaf value index value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( data_definition == NULL )
+	if( libesedb_page_validate_root_page(
+	     root_page,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported root page.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_tree->number_of_leaf_values == -1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( page_tree->root_page_header == NULL )
 	{
-		/* libesedb_page_tree_get_number_of_leaf_values is called to build the leaf_page_descriptors_tree
-		 */
-		if( libesedb_page_tree_get_number_of_leaf_values(
+		if( libesedb_page_tree_read_root_page_header(
 		     page_tree,
-		     file_io_handle,
-		     &number_of_leaf_values,
+		     root_page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
-			 function,
-			 page_tree->root_page_number );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read root page header.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	base_page_number = page_tree->root_page_number;
+#endif
+	result = libesedb_page_tree_get_leaf_value_by_key_from_page(
+	          page_tree,
+	          file_io_handle,
+	          root_page,
+	          leaf_value_key,
+	          data_definition,
+	          0,
+	          error );
 
-	if( libesedb_leaf_page_descriptor_initialize(
-	     &leaf_page_descriptor,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create leaf page descriptor.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	leaf_page_descriptor->first_leaf_value_index = leaf_value_index;
-	leaf_page_descriptor->last_leaf_value_index  = leaf_value_index;
+	return( result );
+}
 
-	result = libcdata_btree_get_value_by_value(
-	          page_tree->leaf_page_descriptors_tree,
-	          (intptr_t *) leaf_page_descriptor,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
-	          &upper_node,
-	          (intptr_t **) &existing_leaf_page_descriptor,
-	          error );
+/* Determines the index of the first page value with a key that is greater than or equal to specific key data
+ * The page values are searched using a binary search, where only the keys of the probed page values are determined
+ * If skip_equal is set the index of the first page value with a key that is greater than the key data is determined
+ * Key data of NULL has no upper bound, hence the page value index is set to the number of page values
+ * The page value index is set to the number of page values if no such page value exists
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_first_page_value_index_by_key_data(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t number_of_page_values,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     uint16_t *page_value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *page_value_key    = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_first_page_value_index_by_key_data";
+	uint16_t high_page_value_index              = 0;
+	uint16_t low_page_value_index               = 0;
+	uint16_t middle_page_value_index            = 0;
+	uint16_t probe_page_value_index             = 0;
+	int compare_result                          = 0;
+	int result                                  = 0;
 
-	if( result == -1 )
+	if( page_value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf page descriptor from tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( key_data == NULL )
 	{
-		if( existing_leaf_page_descriptor == NULL )
+		*page_value_index = number_of_page_values;
+
+		return( 1 );
+	}
+	/* Page value 0 contains the page header or common key and is not part of the search
+	 */
+	low_page_value_index  = 1;
+	high_page_value_index = number_of_page_values;
+
+	while( low_page_value_index < high_page_value_index )
+	{
+		middle_page_value_index = low_page_value_index + ( ( high_page_value_index - low_page_value_index ) / 2 );
+
+		/* Defunct page values have no key and are skipped
+		 */
+		for( probe_page_value_index = middle_page_value_index;
+		     probe_page_value_index < high_page_value_index;
+		     probe_page_value_index++ )
+		{
+			result = libesedb_page_tree_get_key_of_page_value(
+			          page_tree,
+			          page,
+			          page_flags,
+			          probe_page_value_index,
+			          &page_value,
+			          &page_tree_value,
+			          &page_value_key,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 probe_page_value_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( probe_page_value_index >= high_page_value_index )
+		{
+			high_page_value_index = middle_page_value_index;
+
+			continue;
+		}
+		compare_result = libesedb_page_tree_key_compare_data(
+		                  page_value_key,
+		                  key_data,
+		                  key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing existing leaf page descriptor.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key data with key of page value: %" PRIu16 ".",
+			 function,
+			 probe_page_value_index );
 
 			goto on_error;
 		}
-		current_leaf_value_index = existing_leaf_page_descriptor->first_leaf_value_index;
-		base_page_number         = existing_leaf_page_descriptor->page_number;
-	}
-	if( libesedb_leaf_page_descriptor_free(
-	     &leaf_page_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free leaf page descriptor.",
-		 function );
-
-		goto on_error;
-	}
-        /* Use a local cache to prevent cache invalidation of the root page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &base_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create base page cache.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) base_page_cache,
-	     (int) base_page_number - 1,
-	     (intptr_t **) &base_page,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 base_page_number );
+		if( libesedb_page_tree_key_free(
+		     &page_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page value key.",
+			 function );
 
-		goto on_error;
-	}
-	if( base_page_number == page_tree->root_page_number )
-	{
-		if( libesedb_page_validate_root_page(
-		     base_page,
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported root page.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
 			 function );
 
 			goto on_error;
 		}
+		if( ( compare_result == LIBFDATA_COMPARE_GREATER )
+		 || ( ( compare_result == LIBFDATA_COMPARE_EQUAL )
+		  && ( skip_equal != 0 ) ) )
+		{
+			low_page_value_index = probe_page_value_index + 1;
+		}
+		else
+		{
+			high_page_value_index = probe_page_value_index;
+		}
 	}
-	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
-	     page_tree,
-	     file_io_handle,
-	     base_page,
-	     leaf_value_index,
-	     data_definition,
-	     &current_leaf_value_index,
-	     0,
-	     error ) != 1 )
+	/* The search can end on a defunct page value when all page values up to
+	 * the next candidate are defunct
+	 */
+	while( low_page_value_index < number_of_page_values )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
-		 function,
-		 leaf_value_index,
-		 base_page_number );
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     low_page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 low_page_value_index );
 
-		goto on_error;
-	}
-	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current leaf value index value out of bounds.",
-		 function );
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 low_page_value_index );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			break;
+		}
+		low_page_value_index++;
 	}
-	if( libfcache_cache_free(
-	     &base_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free base page cache.",
-		 function );
+	*page_value_index = low_page_value_index;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( *data_definition != NULL )
-	{
-		libesedb_data_definition_free(
-		 data_definition,
-		 NULL );
-	}
-	if( leaf_page_descriptor != NULL )
+	if( page_value_key != NULL )
 	{
-		libesedb_leaf_page_descriptor_free(
-		 &leaf_page_descriptor,
+		libesedb_page_tree_key_free(
+		 &page_value_key,
 		 NULL );
 	}
-	if( base_page_cache != NULL )
+	if( page_tree_value != NULL )
 	{
-		libfcache_cache_free(
-		 &base_page_cache,
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Determines the leaf page and page value index of the first leaf value with a key
+ * that is greater than or equal to specific key data
+ * If skip_equal is set the first leaf value with a key that is greater than the key data is determined
+ * Key data of NULL has no upper bound, hence the last leaf page is determined
+ * The branch pages are descended from the root page, where the page values of every page are searched
+ * using a binary search. The page value index is set to the number of page values in the leaf page if
+ * the leaf value is not in the leaf page, in which case it is the first leaf value in the next leaf page
+ * The leaf page remains in the page cache
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_key_from_page(
+int libesedb_page_tree_get_leaf_page_value_index_by_key_data(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     libesedb_page_t *page,
-     libesedb_page_tree_key_t *leaf_value_key,
-     libesedb_data_definition_t **data_definition,
-     int recursion_depth,
+     libfcache_cache_t *page_cache,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     uint32_t *leaf_page_number,
+     uint16_t *page_value_index,
      libcerror_error_t **error )
 {
+	libesedb_page_t *page                       = NULL;
 	libesedb_page_tree_key_t *page_value_key    = NULL;
-	libesedb_page_t *child_page                 = NULL;
 	libesedb_page_tree_value_t *page_tree_value = NULL;
 	libesedb_page_value_t *page_value           = NULL;
-	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_leaf_value_by_key_from_page";
+	static char *function                       = "libesedb_page_tree_get_leaf_page_value_index_by_key_data";
 	uint32_t child_page_number                  = 0;
 	uint32_t page_flags                         = 0;
-	uint16_t data_offset                        = 0;
+	uint32_t page_number                        = 0;
 	uint16_t number_of_page_values              = 0;
-	uint16_t page_value_index                   = 0;
-	int compare_result                          = 0;
+	uint16_t safe_page_value_index              = 0;
+	int recursion_depth                         = 0;
 	int result                                  = 0;
 
 	if( page_tree == NULL )
@@ -2408,376 +5570,260 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 		return( -1 );
 	}
-	if( data_definition == NULL )
+	if( ( key_data == NULL )
+	 && ( key_data_size > 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
+		 "%s: invalid key data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	if( leaf_page_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_page_get_number_of_values(
-	     page,
-	     &number_of_page_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page values.",
-		 function );
-
-		goto on_error;
-	}
-	if( number_of_page_values == 0 )
-	{
-		return( 1 );
-	}
-	if( libesedb_page_get_flags(
-	     page,
-	     &page_flags,
-	     error ) != 1 )
+	if( page_value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page flags.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
-		 function );
+	page_number = page_tree->root_page_number;
 
-		goto on_error;
-	}
-	for( page_value_index = 1;
-	     page_value_index < number_of_page_values;
-	     page_value_index++ )
+	while( recursion_depth <= LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH )
 	{
-		if( libesedb_page_get_value_by_index(
-		     page,
-		     page_value_index,
-		     &page_value,
-		     error ) != 1 )
+#if ( SIZEOF_INT <= 4 )
+		if( ( page_number < 1 )
+		 || ( page_number > page_tree->io_handle->last_page_number )
+		 || ( page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( page_number < 1 )
+		 || ( page_number > page_tree->io_handle->last_page_number )
+		 || ( (int) page_number > INT_MAX ) )
+#endif
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page number value out of bounds.",
+			 function );
 
 			goto on_error;
 		}
-		if( page_value == NULL )
+		/* The parent page is no longer needed once the child page number is known,
+		 * hence a single page cache can be used for all the levels of the page tree
+		 */
+		if( libesedb_page_get_from_pages_vector(
+		     page_tree->pages_vector,
+		     file_io_handle,
+		     page_cache,
+		     page_tree->io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing page value: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
 			 function,
-			 page_value_index );
+			 page_number );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
-			 function,
-			 page_value_index,
-			 page_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_value->flags );
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		if( recursion_depth == 0 )
 		{
-			continue;
+			result = libesedb_page_validate_root_page(
+			          page,
+			          error );
 		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		else
 		{
-			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported page - root flag is set and page value: %" PRIu16 " has common key.",
-				 function,
-				 page_value_index );
-
-				goto on_error;
-			}
+			result = libesedb_page_validate_page(
+			          page,
+			          error );
 		}
-		if( libesedb_page_tree_value_initialize(
-		     &page_tree_value,
-		     error ) != 1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tree value.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 ".",
+			 function,
+			 page_number );
 
 			goto on_error;
 		}
-		if( libesedb_page_tree_value_read_data(
-		     page_tree_value,
-		     page_value->data,
-		     (size_t) page_value->size,
-		     page_value->flags,
+		if( libesedb_page_get_flags(
+		     page,
+		     &page_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read page tree value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
 
 			goto on_error;
 		}
-		if( libesedb_page_tree_get_key(
-		     page_tree,
-		     page_tree_value,
+		if( libesedb_page_get_number_of_values(
 		     page,
-		     page_flags,
-		     page_value_index,
-		     &page_value_key,
+		     &number_of_page_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key of page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
+			 "%s: unable to retrieve number of page values.",
+			 function );
 
 			goto on_error;
 		}
-		compare_result = libesedb_page_tree_key_compare(
-		                  leaf_value_key,
-		                  page_value_key,
-		                  error );
-
-		if( compare_result == -1 )
+		if( libesedb_page_tree_get_first_page_value_index_by_key_data(
+		     page_tree,
+		     page,
+		     page_flags,
+		     number_of_page_values,
+		     key_data,
+		     key_data_size,
+		     skip_equal,
+		     &safe_page_value_index,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare page value: %" PRIu16 " and leaf value keys.",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
-		{
-			if( compare_result == LIBFDATA_COMPARE_EQUAL )
-			{
-				if( libesedb_data_definition_initialize(
-				     data_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create data definition.",
-					 function );
-
-					goto on_error;
-				}
-				data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
-
-				if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
-				{
-					data_offset += 2;
-				}
-				( *data_definition )->page_value_index = page_value_index;
-				( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
-				( *data_definition )->page_number      = page->page_number;
-				( *data_definition )->data_offset      = data_offset;
-				( *data_definition )->data_size        = page_tree_value->data_size;
-
-				result = 1;
-			}
-		}
-		else if( compare_result != LIBFDATA_COMPARE_GREATER )
-		{
-			if( page_tree_value->data_size < 4 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
-				 function,
-				 page_value_index );
-
-				goto on_error;
-			}
-			byte_stream_copy_to_uint32_little_endian(
-			 page_tree_value->data,
-			 child_page_number );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
-				 function,
-				 page_value_index,
-				 child_page_number );
-
-				if( child_page_number == 0 )
-				{
-					libcnotify_printf(
-					 " (invalid page number)\n" );
-				}
-				else if( child_page_number > page_tree->io_handle->last_page_number )
-				{
-					libcnotify_printf(
-					 " (exceeds last page number: %" PRIu32 ")\n",
-					 page_tree->io_handle->last_page_number );
-				}
-				libcnotify_printf(
-				 "\n" );
-				libcnotify_printf(
-				 "\n" );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine first page value index by key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			if( safe_page_value_index < 1 )
+			{
+				safe_page_value_index = 1;
 			}
-#endif
-#if ( SIZEOF_INT <= 4 )
-			if( ( child_page_number < 1 )
-			 || ( child_page_number > (uint32_t) INT_MAX ) )
-#else
-			if( ( child_page_number < 1 )
-			 || ( (int) child_page_number > INT_MAX ) )
-#endif
+			*leaf_page_number = page_number;
+			*page_value_index = safe_page_value_index;
+
+			return( 1 );
+		}
+		/* The key of the last branch page value has no upper bound, hence the key data can only
+		 * exceed the keys of the branch page values if the last branch page value is defunct
+		 * or if the key data has no upper bound, in which case the last branch page value is used
+		 */
+		result = 0;
+
+		while( ( result == 0 )
+		    && ( safe_page_value_index < number_of_page_values ) )
+		{
+			result = libesedb_page_tree_get_key_of_page_value(
+			          page_tree,
+			          page,
+			          page_flags,
+			          safe_page_value_index,
+			          &page_value,
+			          &page_tree_value,
+			          &page_value_key,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid child page number value out of bounds.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 safe_page_value_index );
 
 				goto on_error;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			else if( result == 0 )
 			{
-				if( page_tree_value->data_size > 4 )
-				{
-					libcnotify_printf(
-					 "%s: page value: %03" PRIu16 " trailing data:\n",
-					 function,
-					 page_value_index );
-					libcnotify_print_data(
-					 &( page_tree_value->data[ 4 ] ),
-					 page_tree_value->data_size - 4,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
+				safe_page_value_index++;
 			}
-#endif
-			if( ( child_page_number > 0 )
-			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
+		}
+		while( ( result == 0 )
+		    && ( safe_page_value_index > 1 ) )
+		{
+			safe_page_value_index--;
+
+			result = libesedb_page_tree_get_key_of_page_value(
+			          page_tree,
+			          page,
+			          page_flags,
+			          safe_page_value_index,
+			          &page_value,
+			          &page_tree_value,
+			          &page_value_key,
+			          error );
+
+			if( result == -1 )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve page: %" PRIu32 ".",
-					 function,
-					 child_page_number );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 safe_page_value_index );
 
-					goto on_error;
-				}
-				if( libesedb_page_validate_page(
-				     child_page,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported page.",
-					 function );
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing branch page values in page: %" PRIu32 ".",
+			 function,
+			 page_number );
 
-					goto on_error;
-				}
-				result = libesedb_page_tree_get_leaf_value_by_key_from_page(
-				          page_tree,
-				          file_io_handle,
-				          child_page,
-				          leaf_value_key,
-				          data_definition,
-				          recursion_depth + 1,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
-					 function,
-					 child_page_number );
+			goto on_error;
+		}
+		if( page_tree_value->data_size < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 safe_page_value_index );
 
-					goto on_error;
-				}
-			}
+			goto on_error;
 		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_tree_value->data,
+		 child_page_number );
+
 		if( libesedb_page_tree_key_free(
 		     &page_value_key,
 		     error ) != 1 )
@@ -2804,33 +5850,30 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 			goto on_error;
 		}
-		if( result != 0 )
+		if( child_page_number == page_number )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid child page number: %" PRIu32 " - self reference.",
+			 function,
+			 child_page_number );
+
+			goto on_error;
 		}
-	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
-		 function );
+		page_number = child_page_number;
 
-		goto on_error;
+		recursion_depth++;
 	}
-	return( result );
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid recursion depth value out of bounds.",
+	 function );
 
 on_error:
-	if( *data_definition != NULL )
-	{
-		libesedb_data_definition_free(
-		 data_definition,
-		 NULL );
-	}
 	if( page_value_key != NULL )
 	{
 		libesedb_page_tree_key_free(
@@ -2843,153 +5886,6 @@ on_error:
 		 &page_tree_value,
 		 NULL );
 	}
-	if( child_page_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &child_page_cache,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves a specific leaf value
- * This function creates a new data definition
- * Returns 1 if successful, 0 if no such value or -1 on error
- */
-int libesedb_page_tree_get_leaf_value_by_key(
-     libesedb_page_tree_t *page_tree,
-     libbfio_handle_t *file_io_handle,
-     libesedb_page_tree_key_t *leaf_value_key,
-     libesedb_data_definition_t **data_definition,
-     libcerror_error_t **error )
-{
-	libesedb_page_t *root_page         = NULL;
-	libfcache_cache_t *root_page_cache = NULL;
-	static char *function              = "libesedb_page_tree_get_leaf_value_by_key";
-	int result                         = 0;
-
-	if( page_tree == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tree.",
-		 function );
-
-		return( -1 );
-	}
-	/* Use a local cache to prevent cache invalidation of the root page
-	 * when reading child pages.
-	 */
-	if( libfcache_cache_initialize(
-	     &root_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root page cache.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 page_tree->root_page_number );
-
-		goto on_error;
-	}
-	if( libesedb_page_validate_root_page(
-	     root_page,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported root page.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( page_tree->root_page_header == NULL )
-	{
-		if( libesedb_page_tree_read_root_page_header(
-		     page_tree,
-		     root_page,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read root page header.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#endif
-	result = libesedb_page_tree_get_leaf_value_by_key_from_page(
-	          page_tree,
-	          file_io_handle,
-	          root_page,
-	          leaf_value_key,
-	          data_definition,
-	          0,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
-		 function,
-		 page_tree->root_page_number );
-
-		goto on_error;
-	}
-	if( libfcache_cache_free(
-	     &root_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root page cache.",
-		 function );
-
-		goto on_error;
-	}
-	return( result );
-
-on_error:
-	if( root_page_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &root_page_cache,
-		 NULL );
-	}
 	return( -1 );
 }
 
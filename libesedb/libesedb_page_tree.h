@@ -37,6 +37,7 @@
 #include "libesedb_page_tree_value.h"
 #include "libesedb_page_value.h"
 #include "libesedb_root_page_header.h"
+#include "libesedb_sidecar.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -84,8 +85,18 @@ struct libesedb_page_tree
 	libcdata_btree_t *leaf_page_descriptors_tree;
 
 	/* The number of leaf values
+	 * -1 until all the leaf pages have been read
 	 */
 	int number_of_leaf_values;
+
+	/* The number of leaf values in the leaf pages read so far
+	 * -1 if no leaf pages have been read
+	 */
+	int number_of_read_leaf_values;
+
+	/* The number of the next leaf page to read
+	 */
+	uint32_t next_leaf_page_number;
 };
 
 int libesedb_page_tree_initialize(
@@ -142,12 +153,51 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_read_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     int *number_of_read_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_read_leaf_page_descriptors_from_sidecar(
+     libesedb_page_tree_t *page_tree,
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_append_leaf_page_descriptors_to_sidecar(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_number_of_leaf_values(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     uint64_t *number_of_leaf_pages,
+     int *number_of_leaf_values,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_number_of_owned_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_owned_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_estimated_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_index_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -165,6 +215,76 @@ int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_read_leaf_value_from_leaf_page(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_data_definition_t *data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_value_from_leaf_page(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_page_descriptors_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     libcdata_array_t *leaf_page_descriptors_array,
+     int *leaf_page_depth,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *leaf_page_descriptors_array,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_key_of_page_value(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_value_t **page_value,
+     libesedb_page_tree_value_t **page_tree_value,
+     libesedb_page_tree_key_t **key,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_compare_key_with_page_value(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_tree_key_t *key,
+     libesedb_page_value_t **page_value,
+     libesedb_page_tree_value_t **page_tree_value,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_first_page_value_index_by_key(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t number_of_page_values,
+     libesedb_page_tree_key_t *key,
+     uint16_t *page_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_value_by_key_from_page_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t page_value_index,
+     libesedb_page_tree_key_t *leaf_value_key,
+     libesedb_data_definition_t **data_definition,
+     int recursion_depth,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_key_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -181,6 +301,28 @@ int libesedb_page_tree_get_leaf_value_by_key(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_first_page_value_index_by_key_data(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     uint16_t number_of_page_values,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     uint16_t *page_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_page_value_index_by_key_data(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *page_cache,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t skip_equal,
+     uint32_t *leaf_page_number,
+     uint16_t *page_value_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -695,3 +695,103 @@ int libesedb_page_tree_key_compare(
 	return( result );
 }
 
+/* Compares data with a page tree key
+ * The data and the key data are compared byte by byte, where the shorter of equal
+ * data is considered less. A branch page tree key without data has no upper bound
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_page_tree_key_compare_data(
+     libesedb_page_tree_key_t *page_tree_key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_page_tree_key_compare_data";
+	size_t compare_data_size = 0;
+	int compare_result       = 0;
+
+	if( page_tree_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree_key->data == NULL )
+	 && ( page_tree_key->data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree key - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree_key->type == LIBESEDB_KEY_TYPE_BRANCH )
+	 && ( page_tree_key->data_size == 0 ) )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	if( data_size <= page_tree_key->data_size )
+	{
+		compare_data_size = data_size;
+	}
+	else
+	{
+		compare_data_size = page_tree_key->data_size;
+	}
+	if( compare_data_size > 0 )
+	{
+		compare_result = memory_compare(
+		                  data,
+		                  page_tree_key->data,
+		                  compare_data_size );
+	}
+	if( compare_result < 0 )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( compare_result > 0 )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	if( data_size < page_tree_key->data_size )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( data_size > page_tree_key->data_size )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	return( LIBFDATA_COMPARE_EQUAL );
+}
+
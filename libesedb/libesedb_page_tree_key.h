@@ -73,6 +73,12 @@ int libesedb_page_tree_key_compare(
      libesedb_page_tree_key_t *second_page_tree_key,
      libcerror_error_t **error );
 
+int libesedb_page_tree_key_compare_data(
+     libesedb_page_tree_key_t *page_tree_key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
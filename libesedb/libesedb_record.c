@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_column_map.h"
 #include "libesedb_compression.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_data_segment.h"
@@ -40,13 +41,15 @@
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_record.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_record_value.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+ * The column projection and record filter are optional and are only used while reading the record
+ * Returns 1 if successful, 0 if the record is rejected by the record filter or -1 on error
  */
 int libesedb_record_initialize(
      libesedb_record_t **record,
@@ -60,10 +63,14 @@ int libesedb_record_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_column_projection_t *column_projection,
+     libesedb_internal_record_filter_t *record_filter,
+     libesedb_column_map_t *column_map,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
 	static char *function                       = "libesedb_record_initialize";
+	int result                                  = 0;
 
 	if( record == NULL )
 	{
@@ -154,17 +161,21 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
-	if( libesedb_data_definition_read_record(
-	     data_definition,
-	     file_io_handle,
-	     io_handle,
-	     pages_vector,
-	     pages_cache,
-	     table_definition,
-	     template_table_definition,
-	     internal_record->values_array,
-	     &( internal_record->flags ),
-	     error ) != 1 )
+	result = libesedb_data_definition_read_record(
+	          data_definition,
+	          file_io_handle,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          table_definition,
+	          template_table_definition,
+	          column_projection,
+	          record_filter,
+	          internal_record->values_array,
+	          &( internal_record->flags ),
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -175,6 +186,18 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		libcdata_array_free(
+		 &( internal_record->values_array ),
+		 NULL,
+		 NULL );
+
+		memory_free(
+		 internal_record );
+
+		return( 0 );
+	}
 	internal_record->file_io_handle            = file_io_handle;
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
@@ -185,6 +208,9 @@ int libesedb_record_initialize(
 	internal_record->long_values_pages_cache   = long_values_pages_cache;
 	internal_record->data_definition           = data_definition;
 	internal_record->long_values_page_tree     = long_values_page_tree;
+	internal_record->column_map                = column_map;
+
+	internal_record->uncompressed_data_value_entry = -1;
 
 	*record = (libesedb_record_t *) internal_record;
 
@@ -253,6 +279,11 @@ int libesedb_record_free(
 				result = -1;
 			}
 		}
+		if( internal_record->uncompressed_data != NULL )
+		{
+			memory_free(
+			 internal_record->uncompressed_data );
+		}
 		if( libcdata_array_free(
 		     &( internal_record->values_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
@@ -273,6 +304,289 @@ int libesedb_record_free(
 	return( result );
 }
 
+/* Retrieves a specific record value
+ * The record value is created on first access
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_record_value_by_index(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *safe_record_value = NULL;
+	static char *function                = "libesedb_record_get_record_value_by_index";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( safe_record_value == NULL )
+	{
+		if( libesedb_data_definition_get_record_value(
+		     internal_record->data_definition,
+		     value_entry,
+		     &safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from data definition.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_record->values_array,
+		     value_entry,
+		     (intptr_t *) safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in values array.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the uncompressed data of a specific compressed record value
+ * The uncompressed data of the most recently decompressed value is cached
+ * so that retrieving the string size and string does not decompress twice
+ * Returns 1 if successful, 0 if the value is not compressed or -1 on error
+ */
+int libesedb_internal_record_get_uncompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t *leading_byte,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *record_value = NULL;
+	uint8_t *entry_data             = NULL;
+	uint8_t *safe_uncompressed_data = NULL;
+	static char *function           = "libesedb_internal_record_get_uncompressed_value_data";
+	size_t entry_data_size          = 0;
+	size_t safe_uncompressed_size   = 0;
+	uint32_t data_flags             = 0;
+	int encoding                    = 0;
+	int result                      = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( leading_byte == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leading byte.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->uncompressed_data != NULL )
+	 && ( internal_record->uncompressed_data_value_entry == value_entry ) )
+	{
+		*uncompressed_data      = internal_record->uncompressed_data;
+		*uncompressed_data_size = internal_record->uncompressed_data_size;
+		*leading_byte           = internal_record->uncompressed_data_leading_byte;
+
+		return( 1 );
+	}
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
+	     value_entry,
+	     &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	result = libfvalue_value_has_data(
+	          record_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value: %d has data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+	 || ( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     record_value,
+	     0,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_compression_decompress_data(
+	     entry_data,
+	     entry_data_size,
+	     &safe_uncompressed_data,
+	     &safe_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( internal_record->uncompressed_data != NULL )
+	{
+		memory_free(
+		 internal_record->uncompressed_data );
+	}
+	internal_record->uncompressed_data              = safe_uncompressed_data;
+	internal_record->uncompressed_data_size         = safe_uncompressed_size;
+	internal_record->uncompressed_data_value_entry  = value_entry;
+	internal_record->uncompressed_data_leading_byte = entry_data[ 0 ];
+
+	*uncompressed_data      = internal_record->uncompressed_data;
+	*uncompressed_data_size = internal_record->uncompressed_data_size;
+	*leading_byte           = internal_record->uncompressed_data_leading_byte;
+
+	return( 1 );
+}
+
 /* Retrieves the number of values in the record
  * Returns 1 if successful or -1 on error
  */
@@ -808,6 +1122,181 @@ int libesedb_record_get_utf16_column_name(
 	return( 1 );
 }
 
+/* Retrieves the value entry of the column with a specific identifier
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_entry_by_column_identifier";
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing column map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          internal_record->column_map,
+	          column_identifier,
+	          value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry from column map.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value entry of the column with a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_get_value_entry_by_utf8_column_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_entry_by_utf8_column_name";
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing column map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          internal_record->column_map,
+	          utf8_string,
+	          utf8_string_length,
+	          value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry from column map.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value entry of the column with a specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_get_value_entry_by_utf16_column_name(
+     libesedb_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_entry_by_utf16_column_name";
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing column map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          internal_record->column_map,
+	          utf16_string,
+	          utf16_string_length,
+	          value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry from column map.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the value of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -849,17 +1338,17 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -940,17 +1429,17 @@ int libesedb_record_get_value_data_flags(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1002,32 +1491,94 @@ int libesedb_record_get_value_data_size(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
+	     value_entry,
+	     &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_size(
+	     record_value,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data size.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value data of the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_value_data(
+     libesedb_record_t *record,
+     int value_entry,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	static char *function                       = "libesedb_record_get_value_data";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
 		return( -1 );
 	}
-	if( libfvalue_value_get_data_size(
+	if( libfvalue_value_copy_data(
 	     record_value,
+	     value_data,
 	     value_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d data size.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value: %d data.",
 		 function,
 		 value_entry );
 
@@ -1036,19 +1587,19 @@ int libesedb_record_get_value_data_size(
 	return( 1 );
 }
 
-/* Retrieves the value data of the specific entry
+/* Retrieves a reference to the value data of the specific entry
+ * The value data is not copied and remains valid until the record is freed
  * Returns 1 if successful or -1 on error
  */
-int libesedb_record_get_value_data(
+int libesedb_record_get_value_data_reference(
      libesedb_record_t *record,
      int value_entry,
-     uint8_t *value_data,
-     size_t value_data_size,
+     const uint8_t **value_data,
+     size_t *value_data_size,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
-	libfvalue_value_t *record_value             = NULL;
-	static char *function                       = "libesedb_record_get_value_data";
+	static char *function                       = "libesedb_record_get_value_data_reference";
 
 	if( record == NULL )
 	{
@@ -1063,24 +1614,9 @@ int libesedb_record_get_value_data(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_data_definition_get_record_value_data_reference(
+	     internal_record->data_definition,
 	     value_entry,
-	     (intptr_t **) &record_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
-		 function,
-		 value_entry );
-
-		return( -1 );
-	}
-	if( libfvalue_value_copy_data(
-	     record_value,
 	     value_data,
 	     value_data_size,
 	     error ) != 1 )
@@ -1088,8 +1624,8 @@ int libesedb_record_get_value_data(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value: %d data.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data reference.",
 		 function,
 		 value_entry );
 
@@ -1168,17 +1704,17 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1291,17 +1827,17 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1415,17 +1951,17 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1539,17 +2075,17 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1664,17 +2200,17 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1787,17 +2323,17 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -1912,17 +2448,17 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2035,17 +2571,17 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2101,9 +2637,12 @@ int libesedb_record_get_value_utf8_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string_size";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
+	uint8_t leading_byte                                     = 0;
 
 	if( record == NULL )
 	{
@@ -2160,17 +2699,58 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	result = libesedb_internal_record_get_uncompressed_value_data(
+	          internal_record,
+	          value_entry,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &leading_byte,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		     leading_byte,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size from compressed value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2211,9 +2791,12 @@ int libesedb_record_get_value_utf8_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf8_string";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
+	uint8_t leading_byte                                     = 0;
 
 	if( record == NULL )
 	{
@@ -2270,17 +2853,59 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	result = libesedb_internal_record_get_uncompressed_value_data(
+	          internal_record,
+	          value_entry,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &leading_byte,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+		     leading_byte,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy compressed value: %d to UTF-8 string.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2320,9 +2945,12 @@ int libesedb_record_get_value_utf16_string_size(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string_size";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
+	uint8_t leading_byte                                     = 0;
 
 	if( record == NULL )
 	{
@@ -2379,17 +3007,58 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	result = libesedb_internal_record_get_uncompressed_value_data(
+	          internal_record,
+	          value_entry,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &leading_byte,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_compression_get_utf16_string_size_from_uncompressed_data(
+		     leading_byte,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size from compressed value: %d.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2430,9 +3099,12 @@ int libesedb_record_get_value_utf16_string(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_internal_record_t *internal_record              = NULL;
 	libfvalue_value_t *record_value                          = NULL;
+	const uint8_t *uncompressed_data                         = NULL;
 	static char *function                                    = "libesedb_record_get_value_utf16_string";
+	size_t uncompressed_data_size                            = 0;
 	uint32_t column_type                                     = 0;
 	int result                                               = 0;
+	uint8_t leading_byte                                     = 0;
 
 	if( record == NULL )
 	{
@@ -2489,17 +3161,59 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	result = libesedb_internal_record_get_uncompressed_value_data(
+	          internal_record,
+	          value_entry,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &leading_byte,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data of value: %d.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_compression_copy_to_utf16_string_from_uncompressed_data(
+		     leading_byte,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     utf16_string,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy compressed value: %d to UTF-16 string.",
+			 function,
+			 value_entry );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2602,17 +3316,17 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2776,17 +3490,17 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2900,17 +3614,17 @@ int libesedb_record_is_long_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -2960,17 +3674,17 @@ int libesedb_record_is_multi_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -3058,6 +3772,19 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		return( -1 );
 	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_record->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_tree_key_initialize(
 	     &key,
 	     error ) != 1 )
@@ -3121,6 +3848,19 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	if( result == 0 )
 	{
+		if( libesedb_io_handle_release_for_write(
+		     internal_record->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release IO handle for write.",
+			 function );
+
+			return( -1 );
+		}
 		return( 0 );
 	}
 	if( libfdata_list_initialize(
@@ -3145,6 +3885,7 @@ int libesedb_record_get_long_value_data_segments_list(
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
 	     internal_record->file_io_handle,
+	     internal_record->io_handle,
 	     internal_record->long_values_pages_vector,
 	     internal_record->long_values_pages_cache,
 	     error ) != 1 )
@@ -3285,9 +4026,30 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	while( result == 1 );
 
+	if( libesedb_io_handle_release_for_write(
+	     internal_record->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		libfdata_list_free(
+		 data_segments_list,
+		 NULL );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
+	libesedb_io_handle_release_for_write(
+	 internal_record->io_handle,
+	 NULL );
+
 	if( *data_segments_list != NULL )
 	{
 		libfdata_list_free(
@@ -3380,17 +4142,17 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
@@ -3610,17 +4372,17 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value_by_index(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from values array.",
+		 "%s: unable to retrieve record value: %d.",
 		 function,
 		 value_entry );
 
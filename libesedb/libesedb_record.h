@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
@@ -33,7 +35,9 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -85,10 +89,30 @@ struct libesedb_internal_record
 	 */
 	libesedb_page_tree_t *long_values_page_tree;
 
+	/* The column map
+	 */
+	libesedb_column_map_t *column_map;
+
 	/* The values array
 	 */
 	libcdata_array_t *values_array;
 
+	/* The uncompressed data of the most recently decompressed value
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The value entry of the uncompressed data
+	 */
+	int uncompressed_data_value_entry;
+
+	/* The leading byte of the compressed data of the uncompressed data
+	 */
+	uint8_t uncompressed_data_leading_byte;
+
 	/* The (record) flags 
 	 */
 	uint8_t flags;
@@ -106,6 +130,9 @@ int libesedb_record_initialize(
      libfcache_cache_t *long_values_pages_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
+     libesedb_column_projection_t *column_projection,
+     libesedb_internal_record_filter_t *record_filter,
+     libesedb_column_map_t *column_map,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -113,6 +140,20 @@ int libesedb_record_free(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_record_get_record_value_by_index(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_internal_record_get_uncompressed_value_data(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     const uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t *leading_byte,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_number_of_values(
      libesedb_record_t *record,
@@ -169,6 +210,29 @@ int libesedb_record_get_utf16_column_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_utf8_column_name(
+     libesedb_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_utf16_column_name(
+     libesedb_record_t *record,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *value_entry,
+     libcerror_error_t **error );
+
 /* TODO deprecate */
 LIBESEDB_EXTERN \
 int libesedb_record_get_value(
@@ -201,6 +265,14 @@ int libesedb_record_get_value_data_flags(
      uint8_t *value_data_flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_boolean(
      libesedb_record_t *record,
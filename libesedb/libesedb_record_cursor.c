@@ -0,0 +1,563 @@
+/*
+ * Record cursor functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
+#include "libesedb_record_cursor.h"
+#include "libesedb_table.h"
+#include "libesedb_types.h"
+
+/* Creates a record cursor
+ * Make sure the value record_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_cursor_initialize(
+     libesedb_record_cursor_t **record_cursor,
+     libesedb_internal_table_t *internal_table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                     = "libesedb_record_cursor_initialize";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = memory_allocate_structure(
+	                          libesedb_internal_record_cursor_t );
+
+	if( internal_record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal record cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_cursor,
+	     0,
+	     sizeof( libesedb_internal_record_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal record cursor.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_cursor->internal_table = internal_table;
+
+	*record_cursor = (libesedb_record_cursor_t *) internal_record_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_cursor != NULL )
+	{
+		memory_free(
+		 internal_record_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a record cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_cursor_free(
+     libesedb_record_cursor_t **record_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                     = "libesedb_record_cursor_free";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_cursor != NULL )
+	{
+		internal_record_cursor = (libesedb_internal_record_cursor_t *) *record_cursor;
+		*record_cursor         = NULL;
+
+		/* The internal_table reference is freed elsewhere
+		 */
+		memory_free(
+		 internal_record_cursor );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next record
+ * The leaf pages are read in order of their next page number, where each leaf page is read once
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_record_cursor_get_next_record(
+     libesedb_record_cursor_t *record_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_cursor_t *internal_record_cursor = NULL;
+	libesedb_internal_table_t *internal_table                 = NULL;
+	static char *function                                     = "libesedb_record_cursor_get_next_record";
+	int result                                                = 0;
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libesedb_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_record_cursor->internal_table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_record_cursor_get_next_record(
+	          internal_record_cursor,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next record.",
+		 function );
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		if( result == 1 )
+		{
+			libesedb_record_free(
+			 record,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next record
+ * The leaf pages are read in order of their next page number, where each leaf page is read once
+ * A leaf page chain that is longer than the number of pages in the file contains a cycle
+ * Records rejected by the record filter of the table are skipped
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_internal_record_cursor_get_next_record(
+     libesedb_internal_record_cursor_t *internal_record_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	libesedb_page_t *leaf_page                         = NULL;
+	static char *function                              = "libesedb_internal_record_cursor_get_next_record";
+	uint32_t next_leaf_page_number                     = 0;
+	uint32_t page_flags                                = 0;
+	uint16_t number_of_page_values                     = 0;
+	int result                                         = 0;
+
+	if( internal_record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_record_cursor->internal_table;
+
+	if( internal_record_cursor->is_initialized == 0 )
+	{
+		if( libesedb_page_tree_get_get_first_leaf_page_number(
+		     internal_table->table_page_tree,
+		     internal_table->file_io_handle,
+		     &( internal_record_cursor->leaf_page_number ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number from table page tree.",
+			 function );
+
+			goto on_error;
+		}
+		internal_record_cursor->page_value_index     = 1;
+		internal_record_cursor->number_of_leaf_pages = 1;
+		internal_record_cursor->is_initialized       = 1;
+	}
+	while( internal_record_cursor->leaf_page_number != 0 )
+	{
+#if ( SIZEOF_INT <= 4 )
+		if( ( internal_record_cursor->leaf_page_number > internal_table->io_handle->last_page_number )
+		 || ( internal_record_cursor->leaf_page_number > (uint32_t) INT_MAX ) )
+#else
+		if( ( internal_record_cursor->leaf_page_number > internal_table->io_handle->last_page_number )
+		 || ( (int) internal_record_cursor->leaf_page_number > INT_MAX ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The leaf page is read through the table pages cache, so that reading
+		 * the records of the leaf page retrieves the same cached page
+		 */
+		if( libesedb_page_get_from_pages_vector(
+		     internal_table->pages_vector,
+		     internal_table->file_io_handle,
+		     internal_table->pages_cache,
+		     internal_table->io_handle,
+		     internal_record_cursor->leaf_page_number,
+		     &leaf_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_record_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_flags(
+		     leaf_page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+			 function,
+			 internal_record_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     leaf_page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		while( internal_record_cursor->page_value_index < number_of_page_values )
+		{
+			result = libesedb_page_tree_get_leaf_value_from_leaf_page(
+			          internal_table->table_page_tree,
+			          leaf_page,
+			          internal_record_cursor->page_value_index,
+			          &record_data_definition,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+				 function,
+				 internal_record_cursor->page_value_index,
+				 internal_record_cursor->leaf_page_number );
+
+				goto on_error;
+			}
+			internal_record_cursor->page_value_index += 1;
+
+			if( result == 0 )
+			{
+				continue;
+			}
+			result = libesedb_record_initialize(
+			          record,
+			          internal_table->file_io_handle,
+			          internal_table->io_handle,
+			          internal_table->table_definition,
+			          internal_table->template_table_definition,
+			          internal_table->pages_vector,
+			          internal_table->pages_cache,
+			          internal_table->long_values_pages_vector,
+			          internal_table->long_values_pages_cache,
+			          record_data_definition,
+			          internal_table->long_values_page_tree,
+			          internal_table->column_projection,
+			          internal_table->record_filter,
+			          internal_table->column_map,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* The record was rejected by the record filter
+				 */
+				if( libesedb_data_definition_free(
+				     &record_data_definition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record data definition.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
+			return( 1 );
+		}
+		if( libesedb_page_get_next_page_number(
+		     leaf_page,
+		     &next_leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 internal_record_cursor->leaf_page_number );
+
+			goto on_error;
+		}
+		if( next_leaf_page_number == internal_record_cursor->leaf_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next page number: %" PRIu32 " - self reference.",
+			 function,
+			 next_leaf_page_number );
+
+			goto on_error;
+		}
+		if( next_leaf_page_number != 0 )
+		{
+			if( internal_record_cursor->number_of_leaf_pages >= internal_table->io_handle->last_page_number )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid next page number: %" PRIu32 " - leaf pages contain a cycle.",
+				 function,
+				 next_leaf_page_number );
+
+				goto on_error;
+			}
+			internal_record_cursor->number_of_leaf_pages += 1;
+		}
+		internal_record_cursor->leaf_page_number = next_leaf_page_number;
+		internal_record_cursor->page_value_index = 1;
+	}
+	return( 0 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
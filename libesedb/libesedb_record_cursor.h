@@ -0,0 +1,88 @@
+/*
+ * Record cursor functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_CURSOR_H )
+#define _LIBESEDB_RECORD_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_record_cursor libesedb_internal_record_cursor_t;
+
+struct libesedb_internal_record_cursor
+{
+	/* The table
+	 */
+	libesedb_internal_table_t *internal_table;
+
+	/* The current leaf page number
+	 */
+	uint32_t leaf_page_number;
+
+	/* The next page value index in the current leaf page
+	 */
+	uint16_t page_value_index;
+
+	/* The number of leaf pages read up to and including the current leaf page
+	 */
+	uint32_t number_of_leaf_pages;
+
+	/* Value to indicate the first leaf page number was determined
+	 */
+	uint8_t is_initialized;
+};
+
+int libesedb_record_cursor_initialize(
+     libesedb_record_cursor_t **record_cursor,
+     libesedb_internal_table_t *internal_table,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_cursor_free(
+     libesedb_record_cursor_t **record_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_cursor_get_next_record(
+     libesedb_record_cursor_t *record_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_internal_record_cursor_get_next_record(
+     libesedb_internal_record_cursor_t *internal_record_cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_CURSOR_H ) */
+
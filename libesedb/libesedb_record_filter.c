@@ -0,0 +1,1162 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_column_map.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_record_filter.h"
+#include "libesedb_types.h"
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_initialize(
+     libesedb_record_filter_t **record_filter,
+     libesedb_column_map_t *column_map,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                     = "libesedb_record_filter_initialize";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = memory_allocate_structure(
+	                          libesedb_internal_record_filter_t );
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_record_filter,
+	     0,
+	     sizeof( libesedb_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal record filter.",
+		 function );
+
+		memory_free(
+		 internal_record_filter );
+
+		return( -1 );
+	}
+	internal_record_filter->column_map        = column_map;
+	internal_record_filter->last_column_entry = -1;
+
+	*record_filter = (libesedb_record_filter_t *) internal_record_filter;
+
+	return( 1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_free(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                     = "libesedb_record_filter_free";
+	int condition_index                                       = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		internal_record_filter = (libesedb_internal_record_filter_t *) *record_filter;
+		*record_filter         = NULL;
+
+		/* The column_map reference is freed elsewhere
+		 */
+		for( condition_index = 0;
+		     condition_index < internal_record_filter->number_of_conditions;
+		     condition_index++ )
+		{
+			if( internal_record_filter->conditions[ condition_index ].value_data != NULL )
+			{
+				memory_free(
+				 internal_record_filter->conditions[ condition_index ].value_data );
+			}
+		}
+		memory_free(
+		 internal_record_filter );
+	}
+	return( 1 );
+}
+
+/* Clones a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_clone(
+     libesedb_record_filter_t **destination_record_filter,
+     libesedb_record_filter_t *source_record_filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_filter_t *internal_destination_record_filter = NULL;
+	libesedb_internal_record_filter_t *internal_source_record_filter      = NULL;
+	libesedb_record_filter_condition_t *condition                         = NULL;
+	static char *function                                                 = "libesedb_record_filter_clone";
+	int condition_index                                                   = 0;
+
+	if( destination_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_record_filter == NULL )
+	{
+		*destination_record_filter = NULL;
+
+		return( 1 );
+	}
+	internal_source_record_filter = (libesedb_internal_record_filter_t *) source_record_filter;
+
+	internal_destination_record_filter = memory_allocate_structure(
+	                                      libesedb_internal_record_filter_t );
+
+	if( internal_destination_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_destination_record_filter,
+	     internal_source_record_filter,
+	     sizeof( libesedb_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination record filter.",
+		 function );
+
+		memory_free(
+		 internal_destination_record_filter );
+
+		return( -1 );
+	}
+	/* The value data of the conditions is not shared with the source record filter
+	 */
+	for( condition_index = 0;
+	     condition_index < internal_destination_record_filter->number_of_conditions;
+	     condition_index++ )
+	{
+		internal_destination_record_filter->conditions[ condition_index ].value_data = NULL;
+	}
+	for( condition_index = 0;
+	     condition_index < internal_destination_record_filter->number_of_conditions;
+	     condition_index++ )
+	{
+		condition = &( internal_source_record_filter->conditions[ condition_index ] );
+
+		if( condition->value_data == NULL )
+		{
+			continue;
+		}
+		internal_destination_record_filter->conditions[ condition_index ].value_data = (uint8_t *) memory_allocate(
+		                                                                                 sizeof( uint8_t ) * condition->value_data_size );
+
+		if( internal_destination_record_filter->conditions[ condition_index ].value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data of condition: %d.",
+			 function,
+			 condition_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_destination_record_filter->conditions[ condition_index ].value_data,
+		     condition->value_data,
+		     condition->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data of condition: %d.",
+			 function,
+			 condition_index );
+
+			goto on_error;
+		}
+	}
+	*destination_record_filter = (libesedb_record_filter_t *) internal_destination_record_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 (libesedb_record_filter_t **) &internal_destination_record_filter,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a condition to the record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_record_filter_append_condition(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int column_entry,
+     int compare_operator,
+     uint8_t value_type,
+     uint64_t value_64bit,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_record_filter_condition_t *condition            = NULL;
+	static char *function                                    = "libesedb_internal_record_filter_append_condition";
+	int supported_column_type                                = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record filter - missing column map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_entry < 0 )
+	 || ( column_entry >= internal_record_filter->column_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compare_operator < LIBESEDB_COMPARE_OPERATOR_EQUAL )
+	 || ( compare_operator > LIBESEDB_COMPARE_OPERATOR_GREATER_EQUAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compare operator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_conditions >= LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_CONDITIONS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record filter - number of conditions value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	column_catalog_definition = internal_record_filter->column_map->entries[ column_entry ].column_catalog_definition;
+
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing column catalog definition: %d.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_INTEGER:
+			switch( column_catalog_definition->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_CURRENCY:
+					supported_column_type = 1;
+					break;
+			}
+			break;
+
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_FILETIME:
+			if( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_DATE_TIME )
+			{
+				supported_column_type = 1;
+			}
+			break;
+
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_BINARY_DATA:
+			switch( column_catalog_definition->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+				case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+				case LIBESEDB_COLUMN_TYPE_TEXT:
+				case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				case LIBESEDB_COLUMN_TYPE_GUID:
+					supported_column_type = 1;
+					break;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( -1 );
+	}
+	if( supported_column_type == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 " for value type: %" PRIu8 ".",
+		 function,
+		 column_catalog_definition->column_type,
+		 value_type );
+
+		return( -1 );
+	}
+	condition = &( internal_record_filter->conditions[ internal_record_filter->number_of_conditions ] );
+
+	if( value_data_size > 0 )
+	{
+		condition->value_data = (uint8_t *) memory_allocate(
+		                                     sizeof( uint8_t ) * value_data_size );
+
+		if( condition->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     condition->value_data,
+		     value_data,
+		     value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			memory_free(
+			 condition->value_data );
+
+			condition->value_data = NULL;
+
+			return( -1 );
+		}
+	}
+	condition->column_entry     = column_entry;
+	condition->column_type      = column_catalog_definition->column_type;
+	condition->compare_operator = compare_operator;
+	condition->value_type       = value_type;
+	condition->value_64bit      = value_64bit;
+	condition->value_data_size  = value_data_size;
+
+	internal_record_filter->expression_items[ internal_record_filter->number_of_expression_items ] = internal_record_filter->number_of_conditions;
+
+	internal_record_filter->number_of_conditions       += 1;
+	internal_record_filter->number_of_expression_items += 1;
+	internal_record_filter->number_of_operands         += 1;
+
+	if( column_entry > internal_record_filter->last_column_entry )
+	{
+		internal_record_filter->last_column_entry = column_entry;
+	}
+	return( 1 );
+}
+
+/* Appends an integer condition to the record filter
+ * The condition compares the value of an integer, boolean or currency column with the integer
+ * The condition is pushed on the expression, refer to libesedb_record_filter_append_and
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_integer_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_append_integer_condition";
+
+	if( libesedb_internal_record_filter_append_condition(
+	     (libesedb_internal_record_filter_t *) record_filter,
+	     column_entry,
+	     compare_operator,
+	     LIBESEDB_RECORD_FILTER_VALUE_TYPE_INTEGER,
+	     (uint64_t) value,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append integer condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a filetime condition to the record filter
+ * The condition compares the value of a date and time column with the filetime
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_filetime_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_append_filetime_condition";
+
+	if( libesedb_internal_record_filter_append_condition(
+	     (libesedb_internal_record_filter_t *) record_filter,
+	     column_entry,
+	     compare_operator,
+	     LIBESEDB_RECORD_FILTER_VALUE_TYPE_FILETIME,
+	     filetime,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filetime condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a binary data condition to the record filter
+ * The condition compares the stored data of a binary data, text or GUID column
+ * byte by byte with the binary data, where the shorter of equal data is considered less
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_binary_data_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_append_binary_data_condition";
+
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_record_filter_append_condition(
+	     (libesedb_internal_record_filter_t *) record_filter,
+	     column_entry,
+	     compare_operator,
+	     LIBESEDB_RECORD_FILTER_VALUE_TYPE_BINARY_DATA,
+	     0,
+	     binary_data,
+	     binary_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append binary data condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a logical operator to the record filter
+ * The logical operator combines the last 2 operands of the expression
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_record_filter_append_logical_operator(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int expression_item,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_record_filter_append_logical_operator";
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( expression_item != LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_AND )
+	 && ( expression_item != LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_OR ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported expression item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_operands < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record filter - missing operands.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every logical operator follows at least 2 conditions, hence the number of
+	 * expression items cannot exceed the maximum when the number of operands is valid
+	 */
+	if( internal_record_filter->number_of_expression_items >= LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_EXPRESSION_ITEMS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record filter - number of expression items value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->expression_items[ internal_record_filter->number_of_expression_items ] = expression_item;
+
+	internal_record_filter->number_of_expression_items += 1;
+	internal_record_filter->number_of_operands         -= 1;
+
+	return( 1 );
+}
+
+/* Appends a logical AND to the record filter
+ * The expression is built in postfix order, for example: a >= 1 AND a < 10 is
+ * appended as the condition a >= 1, the condition a < 10 and then AND
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_and(
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_append_and";
+
+	if( libesedb_internal_record_filter_append_logical_operator(
+	     (libesedb_internal_record_filter_t *) record_filter,
+	     LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_AND,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append logical AND.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a logical OR to the record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_append_or(
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_append_or";
+
+	if( libesedb_internal_record_filter_append_logical_operator(
+	     (libesedb_internal_record_filter_t *) record_filter,
+	     LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_OR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append logical OR.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the stored value data of a column matches a condition
+ * A column without value data does not match. A value that cannot be compared
+ * in its stored form, such as a compressed, long or multi value, matches since
+ * the filter must not reject records that could match
+ * Returns 1 if the value matches, 0 if not or -1 on error
+ */
+int libesedb_record_filter_condition_matches_value(
+     libesedb_record_filter_condition_t *condition,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_data_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_record_filter_condition_matches_value";
+	size_t compare_data_size = 0;
+	uint64_t value_64bit     = 0;
+	int64_t integer_value    = 0;
+	int compare_result       = 0;
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( value_data_flags & ( LIBESEDB_VALUE_FLAG_COMPRESSED | LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) != 0 )
+	{
+		return( 1 );
+	}
+	switch( condition->value_type )
+	{
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_INTEGER:
+			switch( condition->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+					if( value_data_size != 1 )
+					{
+						return( 1 );
+					}
+					integer_value = (int64_t) value_data[ 0 ];
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+					if( value_data_size != 2 )
+					{
+						return( 1 );
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 value_data,
+					 value_64bit );
+
+					if( condition->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+					{
+						integer_value = (int64_t) (int16_t) value_64bit;
+					}
+					else
+					{
+						integer_value = (int64_t) value_64bit;
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+					if( value_data_size != 4 )
+					{
+						return( 1 );
+					}
+					byte_stream_copy_to_uint32_little_endian(
+					 value_data,
+					 value_64bit );
+
+					if( condition->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+					{
+						integer_value = (int64_t) (int32_t) value_64bit;
+					}
+					else
+					{
+						integer_value = (int64_t) value_64bit;
+					}
+					break;
+
+				default:
+					if( value_data_size != 8 )
+					{
+						return( 1 );
+					}
+					byte_stream_copy_to_uint64_little_endian(
+					 value_data,
+					 value_64bit );
+
+					integer_value = (int64_t) value_64bit;
+
+					break;
+			}
+			if( integer_value < (int64_t) condition->value_64bit )
+			{
+				compare_result = -1;
+			}
+			else if( integer_value > (int64_t) condition->value_64bit )
+			{
+				compare_result = 1;
+			}
+			break;
+
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_FILETIME:
+			if( value_data_size != 8 )
+			{
+				return( 1 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			if( value_64bit < condition->value_64bit )
+			{
+				compare_result = -1;
+			}
+			else if( value_64bit > condition->value_64bit )
+			{
+				compare_result = 1;
+			}
+			break;
+
+		case LIBESEDB_RECORD_FILTER_VALUE_TYPE_BINARY_DATA:
+			if( value_data_size <= condition->value_data_size )
+			{
+				compare_data_size = value_data_size;
+			}
+			else
+			{
+				compare_data_size = condition->value_data_size;
+			}
+			if( compare_data_size > 0 )
+			{
+				compare_result = memory_compare(
+				                  value_data,
+				                  condition->value_data,
+				                  compare_data_size );
+			}
+			if( compare_result == 0 )
+			{
+				if( value_data_size < condition->value_data_size )
+				{
+					compare_result = -1;
+				}
+				else if( value_data_size > condition->value_data_size )
+				{
+					compare_result = 1;
+				}
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported condition value type: %" PRIu8 ".",
+			 function,
+			 condition->value_type );
+
+			return( -1 );
+	}
+	switch( condition->compare_operator )
+	{
+		case LIBESEDB_COMPARE_OPERATOR_EQUAL:
+			return( compare_result == 0 );
+
+		case LIBESEDB_COMPARE_OPERATOR_NOT_EQUAL:
+			return( compare_result != 0 );
+
+		case LIBESEDB_COMPARE_OPERATOR_LESS:
+			return( compare_result < 0 );
+
+		case LIBESEDB_COMPARE_OPERATOR_LESS_EQUAL:
+			return( compare_result <= 0 );
+
+		case LIBESEDB_COMPARE_OPERATOR_GREATER:
+			return( compare_result > 0 );
+
+		case LIBESEDB_COMPARE_OPERATOR_GREATER_EQUAL:
+			return( compare_result >= 0 );
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported condition compare operator: %d.",
+	 function,
+	 condition->compare_operator );
+
+	return( -1 );
+}
+
+/* Evaluates the conditions of a specific column
+ * The bit of every condition of the column that matches is set in the condition results
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_filter_evaluate_column(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int column_entry,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_data_flags,
+     uint64_t *condition_results,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_filter_evaluate_column";
+	int condition_index   = 0;
+	int result            = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( condition_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition results.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entry > internal_record_filter->last_column_entry )
+	{
+		return( 1 );
+	}
+	for( condition_index = 0;
+	     condition_index < internal_record_filter->number_of_conditions;
+	     condition_index++ )
+	{
+		if( internal_record_filter->conditions[ condition_index ].column_entry != column_entry )
+		{
+			continue;
+		}
+		result = libesedb_record_filter_condition_matches_value(
+		          &( internal_record_filter->conditions[ condition_index ] ),
+		          value_data,
+		          value_data_size,
+		          value_data_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if value matches condition: %d.",
+			 function,
+			 condition_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*condition_results |= (uint64_t) 1 << condition_index;
+		}
+	}
+	return( 1 );
+}
+
+/* Evaluates the expression of the record filter
+ * The operands of the expression are kept as bits on a 64-bit stack
+ * An empty expression matches every record
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libesedb_record_filter_evaluate_expression(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     uint64_t condition_results,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_record_filter_evaluate_expression";
+	uint64_t operand_stack    = 0;
+	uint8_t first_operand     = 0;
+	uint8_t second_operand    = 0;
+	int expression_item       = 0;
+	int expression_item_index = 0;
+	int number_of_operands    = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->number_of_expression_items == 0 )
+	{
+		return( 1 );
+	}
+	for( expression_item_index = 0;
+	     expression_item_index < internal_record_filter->number_of_expression_items;
+	     expression_item_index++ )
+	{
+		expression_item = internal_record_filter->expression_items[ expression_item_index ];
+
+		if( expression_item >= 0 )
+		{
+			if( number_of_operands >= 64 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of operands value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			operand_stack <<= 1;
+			operand_stack  |= ( condition_results >> expression_item ) & 1;
+
+			number_of_operands++;
+		}
+		else
+		{
+			if( number_of_operands < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid record filter - missing operands.",
+				 function );
+
+				return( -1 );
+			}
+			second_operand = (uint8_t) ( operand_stack & 1 );
+			operand_stack >>= 1;
+			first_operand  = (uint8_t) ( operand_stack & 1 );
+			operand_stack >>= 1;
+
+			number_of_operands -= 2;
+
+			operand_stack <<= 1;
+
+			if( expression_item == LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_AND )
+			{
+				operand_stack |= first_operand & second_operand;
+			}
+			else
+			{
+				operand_stack |= first_operand | second_operand;
+			}
+			number_of_operands++;
+		}
+	}
+	if( number_of_operands != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record filter - incomplete expression.",
+		 function );
+
+		return( -1 );
+	}
+	return( (int) ( operand_stack & 1 ) );
+}
+
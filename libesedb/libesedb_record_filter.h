@@ -0,0 +1,211 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_FILTER_H )
+#define _LIBESEDB_RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_column_map.h"
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of conditions of a record filter
+ * the condition results of a record are stored as bits of a 64-bit value
+ */
+#define LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_CONDITIONS		64
+
+/* The maximum number of expression items of a record filter
+ * which are the conditions and the logical operators that combine them
+ */
+#define LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_EXPRESSION_ITEMS	( ( 2 * LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_CONDITIONS ) - 1 )
+
+/* The logical operator expression items, other expression items are condition indexes
+ */
+#define LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_AND			-1
+#define LIBESEDB_RECORD_FILTER_EXPRESSION_ITEM_OR			-2
+
+typedef struct libesedb_record_filter_condition libesedb_record_filter_condition_t;
+
+struct libesedb_record_filter_condition
+{
+	/* The column entry
+	 */
+	int column_entry;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The compare operator
+	 */
+	int compare_operator;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The 64-bit value of an integer or filetime condition
+	 */
+	uint64_t value_64bit;
+
+	/* The value data of a binary data condition
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+};
+
+typedef struct libesedb_internal_record_filter libesedb_internal_record_filter_t;
+
+struct libesedb_internal_record_filter
+{
+	/* The column map of the table
+	 */
+	libesedb_column_map_t *column_map;
+
+	/* The conditions
+	 */
+	libesedb_record_filter_condition_t conditions[ LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_CONDITIONS ];
+
+	/* The number of conditions
+	 */
+	int number_of_conditions;
+
+	/* The expression items in postfix order
+	 */
+	int expression_items[ LIBESEDB_RECORD_FILTER_MAXIMUM_NUMBER_OF_EXPRESSION_ITEMS ];
+
+	/* The number of expression items
+	 */
+	int number_of_expression_items;
+
+	/* The number of operands the expression items leave on the evaluation stack
+	 * a complete expression leaves 1 operand
+	 */
+	int number_of_operands;
+
+	/* The last column entry used by the conditions
+	 * columns after the last column entry are not needed to evaluate the filter
+	 */
+	int last_column_entry;
+};
+
+int libesedb_record_filter_initialize(
+     libesedb_record_filter_t **record_filter,
+     libesedb_column_map_t *column_map,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_free(
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_clone(
+     libesedb_record_filter_t **destination_record_filter,
+     libesedb_record_filter_t *source_record_filter,
+     libcerror_error_t **error );
+
+int libesedb_internal_record_filter_append_condition(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int column_entry,
+     int compare_operator,
+     uint8_t value_type,
+     uint64_t value_64bit,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_append_integer_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     int64_t value,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_append_filetime_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_append_binary_data_condition(
+     libesedb_record_filter_t *record_filter,
+     int column_entry,
+     int compare_operator,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_record_filter_append_logical_operator(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int expression_item,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_append_and(
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_filter_append_or(
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_condition_matches_value(
+     libesedb_record_filter_condition_t *condition,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_data_flags,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_evaluate_column(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     int column_entry,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t value_data_flags,
+     uint64_t *condition_results,
+     libcerror_error_t **error );
+
+int libesedb_record_filter_evaluate_expression(
+     libesedb_internal_record_filter_t *internal_record_filter,
+     uint64_t condition_results,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_FILTER_H ) */
+
@@ -0,0 +1,1006 @@
+/*
+ * Scan worker functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_leaf_page_descriptor.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
+#include "libesedb_scan_worker.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+/* Creates a scan worker
+ * Make sure the value scan_worker is referencing, is set to NULL
+ * The scan worker uses a clone of the file IO handle, a copy of the IO handle
+ * and its own pages vector and cache so that it does not share state with other workers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_scan_worker_initialize(
+     libesedb_scan_worker_t **scan_worker,
+     int worker_index,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
+     libesedb_column_map_t *column_map,
+     libesedb_internal_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_scan_worker_initialize";
+	int file_io_handle_is_open = 0;
+	int segment_index          = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid worker index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_worker = memory_allocate_structure(
+	                libesedb_scan_worker_t );
+
+	if( *scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_worker,
+	     0,
+	     sizeof( libesedb_scan_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan worker.",
+		 function );
+
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+
+		return( -1 );
+	}
+	( *scan_worker )->io_handle = memory_allocate_structure(
+	                               libesedb_io_handle_t );
+
+	if( ( *scan_worker )->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *scan_worker )->io_handle,
+	     io_handle,
+	     sizeof( libesedb_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pages cache of the worker is not the file-wide pages cache
+	 * and the memory map is read-only hence can be shared
+	 */
+	( *scan_worker )->io_handle->pages_cache                   = NULL;
+	( *scan_worker )->io_handle->number_of_pages_cache_lookups = 0;
+	( *scan_worker )->io_handle->number_of_pages_cache_misses  = 0;
+	( *scan_worker )->io_handle->abort                         = 0;
+
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	/* The scan worker does not share its file IO handle and pages cache
+	 * hence does not need to serialize access
+	 */
+	( *scan_worker )->io_handle->read_write_lock = NULL;
+#endif
+
+	if( libbfio_handle_clone(
+	     &( ( *scan_worker )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          ( *scan_worker )->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *scan_worker )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfdata_vector_initialize(
+	     &( ( *scan_worker )->pages_vector ),
+	     (size64_t) io_handle->page_size,
+	     (intptr_t *) ( *scan_worker )->io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     ( *scan_worker )->pages_vector,
+	     &segment_index,
+	     0,
+	     io_handle->pages_data_offset,
+	     io_handle->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *scan_worker )->pages_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_SCAN_WORKER_PAGES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     &( ( *scan_worker )->table_page_tree ),
+	     ( *scan_worker )->io_handle,
+	     ( *scan_worker )->pages_vector,
+	     ( *scan_worker )->pages_cache,
+	     table_definition->table_catalog_definition->identifier,
+	     table_definition->table_catalog_definition->father_data_page_number,
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libesedb_page_tree_initialize(
+		     &( ( *scan_worker )->long_values_page_tree ),
+		     ( *scan_worker )->io_handle,
+		     ( *scan_worker )->pages_vector,
+		     ( *scan_worker )->pages_cache,
+		     table_definition->long_value_catalog_definition->identifier,
+		     table_definition->long_value_catalog_definition->father_data_page_number,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long value page tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *scan_worker )->worker_index              = worker_index;
+	( *scan_worker )->parent_io_handle          = io_handle;
+	( *scan_worker )->table_definition          = table_definition;
+	( *scan_worker )->template_table_definition = template_table_definition;
+	( *scan_worker )->column_projection         = column_projection;
+	( *scan_worker )->column_map                = column_map;
+	( *scan_worker )->record_filter             = record_filter;
+
+	return( 1 );
+
+on_error:
+	if( *scan_worker != NULL )
+	{
+		libesedb_scan_worker_free(
+		 scan_worker,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a scan worker
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_scan_worker_free(
+     libesedb_scan_worker_t **scan_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_scan_worker_free";
+	int result            = 1;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+		/* The parent_io_handle, table_definition, template_table_definition, column_projection,
+		 * column_map, record_filter and leaf_page_descriptors_array references are freed elsewhere
+		 */
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan_worker )->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *scan_worker )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *scan_worker )->long_values_page_tree != NULL )
+		{
+			if( libesedb_page_tree_free(
+			     &( ( *scan_worker )->long_values_page_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values page tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->table_page_tree != NULL )
+		{
+			if( libesedb_page_tree_free(
+			     &( ( *scan_worker )->table_page_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free table page tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->pages_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *scan_worker )->pages_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pages cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->pages_vector != NULL )
+		{
+			if( libfdata_vector_free(
+			     &( ( *scan_worker )->pages_vector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pages vector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *scan_worker )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->io_handle != NULL )
+		{
+			memory_free(
+			 ( *scan_worker )->io_handle );
+		}
+		if( ( *scan_worker )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *scan_worker )->error ) );
+		}
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+	}
+	return( result );
+}
+
+/* Sets the range of leaf pages the scan worker scans
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_scan_worker_set_leaf_pages(
+     libesedb_scan_worker_t *scan_worker,
+     libcdata_array_t *leaf_page_descriptors_array,
+     int first_leaf_page_index,
+     int number_of_leaf_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_scan_worker_set_leaf_pages";
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_descriptors_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_leaf_page_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first leaf page index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_pages < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of leaf pages value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	scan_worker->leaf_page_descriptors_array = leaf_page_descriptors_array;
+	scan_worker->first_leaf_page_index       = first_leaf_page_index;
+	scan_worker->number_of_leaf_pages        = number_of_leaf_pages;
+
+	return( 1 );
+}
+
+/* Sets the callback function the scan worker calls for every record
+ * The callback function returns 1 to continue, 0 to stop the scan or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_scan_worker_set_callback(
+     libesedb_scan_worker_t *scan_worker,
+     int (*callback_function)(
+            libesedb_record_t *record,
+            int worker_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_scan_worker_set_callback";
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	scan_worker->callback_function = callback_function;
+	scan_worker->callback_data     = callback_data;
+
+	return( 1 );
+}
+
+/* Scans the records in a specific leaf page
+ * The records are freed after the callback function returns
+ * Returns 1 if successful, 0 if the callback function stopped the scan or -1 on error
+ */
+int libesedb_scan_worker_scan_leaf_page(
+     libesedb_scan_worker_t *scan_worker,
+     uint32_t leaf_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_page_t *leaf_page                         = NULL;
+	libesedb_record_t *record                          = NULL;
+	static char *function                              = "libesedb_scan_worker_scan_leaf_page";
+	uint32_t page_flags                                = 0;
+	uint16_t number_of_page_values                     = 0;
+	uint16_t page_value_index                          = 0;
+	int result                                         = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan worker - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan worker - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_INT <= 4 )
+	if( ( leaf_page_number < 1 )
+	 || ( leaf_page_number > scan_worker->io_handle->last_page_number )
+	 || ( leaf_page_number > (uint32_t) INT_MAX ) )
+#else
+	if( ( leaf_page_number < 1 )
+	 || ( leaf_page_number > scan_worker->io_handle->last_page_number )
+	 || ( (int) leaf_page_number > INT_MAX ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_from_pages_vector(
+	     scan_worker->pages_vector,
+	     scan_worker->file_io_handle,
+	     scan_worker->pages_cache,
+	     scan_worker->io_handle,
+	     leaf_page_number,
+	     &leaf_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 leaf_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_flags(
+	     leaf_page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+		 function,
+		 leaf_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_number_of_values(
+	     leaf_page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		result = libesedb_page_tree_get_leaf_value_from_leaf_page(
+		          scan_worker->table_page_tree,
+		          leaf_page,
+		          page_value_index,
+		          &record_data_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+			 function,
+			 page_value_index,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		result = libesedb_record_initialize(
+		          &record,
+		          scan_worker->file_io_handle,
+		          scan_worker->io_handle,
+		          scan_worker->table_definition,
+		          scan_worker->template_table_definition,
+		          scan_worker->pages_vector,
+		          scan_worker->pages_cache,
+		          scan_worker->pages_vector,
+		          scan_worker->pages_cache,
+		          record_data_definition,
+		          scan_worker->long_values_page_tree,
+		          scan_worker->column_projection,
+		          scan_worker->record_filter,
+		          scan_worker->column_map,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The record was rejected by the record filter
+			 */
+			if( libesedb_data_definition_free(
+			     &record_data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record data definition.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		/* The record now manages the data definition
+		 */
+		record_data_definition = NULL;
+
+		result = scan_worker->callback_function(
+		          record,
+		          scan_worker->worker_index,
+		          scan_worker->callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+			 function,
+			 page_value_index,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the records in the leaf pages of the scan worker
+ * Returns 1 if successful, 0 if the scan was stopped or -1 on error
+ */
+int libesedb_scan_worker_scan(
+     libesedb_scan_worker_t *scan_worker,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor = NULL;
+	static char *function                                 = "libesedb_scan_worker_scan";
+	int leaf_page_index                                   = 0;
+	int result                                            = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker->parent_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan worker - missing parent IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_page_index = 0;
+	     leaf_page_index < scan_worker->number_of_leaf_pages;
+	     leaf_page_index++ )
+	{
+		if( scan_worker->parent_io_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     scan_worker->leaf_page_descriptors_array,
+		     scan_worker->first_leaf_page_index + leaf_page_index,
+		     (intptr_t **) &leaf_page_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page descriptor: %d.",
+			 function,
+			 scan_worker->first_leaf_page_index + leaf_page_index );
+
+			return( -1 );
+		}
+		if( leaf_page_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing leaf page descriptor: %d.",
+			 function,
+			 scan_worker->first_leaf_page_index + leaf_page_index );
+
+			return( -1 );
+		}
+		result = libesedb_scan_worker_scan_leaf_page(
+		          scan_worker,
+		          leaf_page_descriptor->page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan leaf page: %" PRIu32 ".",
+			 function,
+			 leaf_page_descriptor->page_number );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Runs the scan worker
+ * This function is used as the thread callback function, the result and error
+ * of the scan are stored in the scan worker
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_scan_worker_run(
+     libesedb_scan_worker_t *scan_worker )
+{
+	if( scan_worker == NULL )
+	{
+		return( -1 );
+	}
+	scan_worker->result = libesedb_scan_worker_scan(
+	                       scan_worker,
+	                       &( scan_worker->error ) );
+
+	return( 1 );
+}
+
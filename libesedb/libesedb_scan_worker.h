@@ -0,0 +1,194 @@
+/*
+ * Scan worker functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_SCAN_WORKER_H )
+#define _LIBESEDB_SCAN_WORKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
+#include "libesedb_extern.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record_filter.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_scan_worker libesedb_scan_worker_t;
+
+struct libesedb_scan_worker
+{
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The IO handle
+	 * a copy of the IO handle of the file so that the worker does not update shared state
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The IO handle of the file that signals abort
+	 */
+	libesedb_io_handle_t *parent_io_handle;
+
+	/* The file IO handle
+	 * a clone of the file IO handle of the file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The pages vector
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 */
+	libfcache_cache_t *pages_cache;
+
+	/* The table definition
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The template table definition
+	 */
+	libesedb_table_definition_t *template_table_definition;
+
+	/* The table page tree
+	 */
+	libesedb_page_tree_t *table_page_tree;
+
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The column projection
+	 */
+	libesedb_column_projection_t *column_projection;
+
+	/* The column map
+	 */
+	libesedb_column_map_t *column_map;
+
+	/* The record filter
+	 */
+	libesedb_internal_record_filter_t *record_filter;
+
+	/* The leaf page descriptors array
+	 */
+	libcdata_array_t *leaf_page_descriptors_array;
+
+	/* The index of the first leaf page to scan
+	 */
+	int first_leaf_page_index;
+
+	/* The number of leaf pages to scan
+	 */
+	int number_of_leaf_pages;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libesedb_record_t *record,
+	       int worker_index,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result of the scan
+	 */
+	int result;
+
+	/* The error of the scan
+	 */
+	libcerror_error_t *error;
+};
+
+int libesedb_scan_worker_initialize(
+     libesedb_scan_worker_t **scan_worker,
+     int worker_index,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_column_projection_t *column_projection,
+     libesedb_column_map_t *column_map,
+     libesedb_internal_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_free(
+     libesedb_scan_worker_t **scan_worker,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_set_leaf_pages(
+     libesedb_scan_worker_t *scan_worker,
+     libcdata_array_t *leaf_page_descriptors_array,
+     int first_leaf_page_index,
+     int number_of_leaf_pages,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_set_callback(
+     libesedb_scan_worker_t *scan_worker,
+     int (*callback_function)(
+            libesedb_record_t *record,
+            int worker_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_scan_leaf_page(
+     libesedb_scan_worker_t *scan_worker,
+     uint32_t leaf_page_number,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_scan(
+     libesedb_scan_worker_t *scan_worker,
+     libcerror_error_t **error );
+
+int libesedb_scan_worker_run(
+     libesedb_scan_worker_t *scan_worker );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_SCAN_WORKER_H ) */
+
@@ -0,0 +1,1288 @@
+/*
+ * Sidecar cache file functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_checksum.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+#include "libesedb_sidecar.h"
+
+#include "esedb_sidecar.h"
+
+const uint8_t esedb_sidecar_signature[ 8 ] = { 'E', 'S', 'E', 'D', 'B', 'S', 'C', 0x00 };
+
+/* Creates a sidecar
+ * Make sure the value sidecar is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_initialize(
+     libesedb_sidecar_t **sidecar,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_sidecar_initialize";
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sidecar != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sidecar value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sidecar = memory_allocate_structure(
+	            libesedb_sidecar_t );
+
+	if( *sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sidecar.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sidecar,
+	     0,
+	     sizeof( libesedb_sidecar_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sidecar.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *sidecar != NULL )
+	{
+		memory_free(
+		 *sidecar );
+
+		*sidecar = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sidecar
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_free(
+     libesedb_sidecar_t **sidecar,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_sidecar_free";
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sidecar != NULL )
+	{
+		if( ( *sidecar )->sections_data != NULL )
+		{
+			memory_free(
+			 ( *sidecar )->sections_data );
+		}
+		memory_free(
+		 *sidecar );
+
+		*sidecar = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the sections of a sidecar
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_clear_sections(
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_sidecar_clear_sections";
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->sections_data != NULL )
+	{
+		memory_free(
+		 sidecar->sections_data );
+
+		sidecar->sections_data = NULL;
+	}
+	sidecar->sections_data_size           = 0;
+	sidecar->allocated_sections_data_size = 0;
+	sidecar->number_of_sections           = 0;
+	sidecar->last_section_offset          = 0;
+
+	return( 1 );
+}
+
+/* Resizes the sections data so that it can contain at least a specific size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_resize_sections_data(
+     libesedb_sidecar_t *sidecar,
+     size_t sections_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation                  = NULL;
+	static char *function               = "libesedb_sidecar_resize_sections_data";
+	size_t allocated_sections_data_size = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( sections_data_size > (size_t) ( LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE - sizeof( esedb_sidecar_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sections data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sections_data_size <= sidecar->allocated_sections_data_size )
+	{
+		return( 1 );
+	}
+	/* The sections data is grown in steps to limit the number of reallocations
+	 */
+	allocated_sections_data_size = sidecar->allocated_sections_data_size;
+
+	if( allocated_sections_data_size == 0 )
+	{
+		allocated_sections_data_size = 4096;
+	}
+	while( allocated_sections_data_size < sections_data_size )
+	{
+		allocated_sections_data_size *= 2;
+	}
+	if( allocated_sections_data_size > (size_t) ( LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE - sizeof( esedb_sidecar_header_t ) ) )
+	{
+		allocated_sections_data_size = (size_t) ( LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE - sizeof( esedb_sidecar_header_t ) );
+	}
+	reallocation = memory_reallocate(
+	                sidecar->sections_data,
+	                sizeof( uint8_t ) * allocated_sections_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize sections data.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar->sections_data                = (uint8_t *) reallocation;
+	sidecar->allocated_sections_data_size = allocated_sections_data_size;
+
+	return( 1 );
+}
+
+/* Reads the sidecar data
+ * The page size, file size, file header checksum and database time of the sidecar
+ * must be set to the values of the database file before reading
+ * Returns 1 if successful, 0 if the data is not a valid sidecar of the database file or -1 on error
+ */
+int libesedb_sidecar_read_data(
+     libesedb_sidecar_t *sidecar,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *sections_data       = NULL;
+	static char *function              = "libesedb_sidecar_read_data";
+	size_t entries_data_offset         = 0;
+	size_t last_section_offset         = 0;
+	size_t section_data_offset         = 0;
+	size_t sections_data_size          = 0;
+	uint64_t database_time             = 0;
+	uint64_t file_size                 = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t entry_data_size           = 0;
+	uint32_t entry_index               = 0;
+	uint32_t file_header_checksum      = 0;
+	uint32_t format_version            = 0;
+	uint32_t number_of_entries         = 0;
+	uint32_t number_of_sections        = 0;
+	uint32_t page_size                 = 0;
+	uint32_t section_data_size         = 0;
+	uint32_t section_index             = 0;
+	uint32_t stored_xor32_checksum     = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_sidecar_header_t ) )
+	 || ( data_size > (size_t) LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported sidecar data size: %" PRIzd "\n",
+			 function,
+			 data_size );
+		}
+#endif
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (esedb_sidecar_header_t *) data )->signature,
+	     esedb_sidecar_signature,
+	     8 ) != 0 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported sidecar signature.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->page_size,
+	 page_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->file_header_checksum,
+	 file_header_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->number_of_sections,
+	 number_of_sections );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->database_time,
+	 database_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->sections_data_size,
+	 section_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) data )->sections_data_checksum,
+	 stored_xor32_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: page size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 page_size );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: file header checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 file_header_checksum );
+
+		libcnotify_printf(
+		 "%s: number of sections\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_sections );
+
+		libcnotify_printf(
+		 "%s: database time\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 database_time );
+
+		libcnotify_printf(
+		 "%s: sections data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 section_data_size );
+
+		libcnotify_printf(
+		 "%s: sections data checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_xor32_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( format_version != 1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported sidecar format version: %" PRIu32 ".\n",
+			 function,
+			 format_version );
+		}
+#endif
+		return( 0 );
+	}
+	/* A sidecar that was written for another version of the database file is stale
+	 */
+	if( ( page_size != sidecar->page_size )
+	 || ( file_size != (uint64_t) sidecar->file_size )
+	 || ( file_header_checksum != sidecar->file_header_checksum )
+	 || ( database_time != sidecar->database_time ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sidecar does not match database file.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	sections_data      = &( data[ sizeof( esedb_sidecar_header_t ) ] );
+	sections_data_size = data_size - sizeof( esedb_sidecar_header_t );
+
+	if( (size_t) section_data_size != sections_data_size )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in sidecar sections data size.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     sections_data,
+	     sections_data_size,
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in sidecar sections data checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_xor32_checksum,
+			 calculated_xor32_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	/* Validate the bounds of all the sections and entries upfront so that
+	 * the sections can be used without further bounds checks
+	 */
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( sizeof( esedb_sidecar_section_header_t ) > ( sections_data_size - section_data_offset ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_section_header_t *) &( sections_data[ section_data_offset ] ) )->number_of_entries,
+		 number_of_entries );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_sidecar_section_header_t *) &( sections_data[ section_data_offset ] ) )->data_size,
+		 section_data_size );
+
+		last_section_offset  = section_data_offset;
+		section_data_offset += sizeof( esedb_sidecar_section_header_t );
+
+		if( (size_t) section_data_size > ( sections_data_size - section_data_offset ) )
+		{
+			return( 0 );
+		}
+		entries_data_offset = 0;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( ( (size_t) section_data_size - entries_data_offset ) < 4 )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( sections_data[ section_data_offset + entries_data_offset ] ),
+			 entry_data_size );
+
+			entries_data_offset += 4;
+
+			if( (size_t) entry_data_size > ( (size_t) section_data_size - entries_data_offset ) )
+			{
+				return( 0 );
+			}
+			entries_data_offset += entry_data_size;
+		}
+		if( entries_data_offset != (size_t) section_data_size )
+		{
+			return( 0 );
+		}
+		section_data_offset += section_data_size;
+	}
+	if( section_data_offset != sections_data_size )
+	{
+		return( 0 );
+	}
+	if( libesedb_sidecar_clear_sections(
+	     sidecar,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( sections_data_size > 0 )
+	{
+		if( libesedb_sidecar_resize_sections_data(
+		     sidecar,
+		     sections_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize sections data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     sidecar->sections_data,
+		     sections_data,
+		     sections_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sections data.",
+			 function );
+
+			libesedb_sidecar_clear_sections(
+			 sidecar,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	sidecar->sections_data_size  = sections_data_size;
+	sidecar->number_of_sections  = number_of_sections;
+	sidecar->last_section_offset = last_section_offset;
+
+	return( 1 );
+}
+
+/* Reads the sidecar
+ * Returns 1 if successful, 0 if the file is not a valid sidecar of the database file or -1 on error
+ */
+int libesedb_sidecar_read_file_io_handle(
+     libesedb_sidecar_t *sidecar,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_sidecar_read_file_io_handle";
+	size64_t data_size    = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sidecar size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size < (size64_t) sizeof( esedb_sidecar_header_t ) )
+	 || ( data_size > (size64_t) LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE ) )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sidecar data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek sidecar offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          data,
+	          (size_t) data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Writes the sidecar
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_write_file_io_handle(
+     libesedb_sidecar_t *sidecar,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( esedb_sidecar_header_t ) ];
+
+	static char *function   = "libesedb_sidecar_write_file_io_handle";
+	uint32_t xor32_checksum = 0;
+	ssize_t write_count     = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->sections_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sidecar - sections data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->sections_data_size > 0 )
+	{
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &xor32_checksum,
+		     sidecar->sections_data,
+		     sidecar->sections_data_size,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		xor32_checksum = 0x89abcdef;
+	}
+	if( memory_copy(
+	     ( (esedb_sidecar_header_t *) header_data )->signature,
+	     esedb_sidecar_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->page_size,
+	 sidecar->page_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->file_size,
+	 sidecar->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->file_header_checksum,
+	 sidecar->file_header_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->number_of_sections,
+	 sidecar->number_of_sections );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->database_time,
+	 sidecar->database_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->sections_data_size,
+	 (uint32_t) sidecar->sections_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_sidecar_header_t *) header_data )->sections_data_checksum,
+	 xor32_checksum );
+
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek sidecar offset: 0.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               header_data,
+	               sizeof( esedb_sidecar_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( esedb_sidecar_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar header.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->sections_data_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               sidecar->sections_data,
+		               sidecar->sections_data_size,
+		               error );
+
+		if( write_count != (ssize_t) sidecar->sections_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sidecar sections data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the entries data of a specific section
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libesedb_sidecar_get_section(
+     libesedb_sidecar_t *sidecar,
+     uint32_t section_type,
+     uint32_t root_page_number,
+     const uint8_t **entries_data,
+     size_t *entries_data_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_section_header_t *section_header = NULL;
+	static char *function                          = "libesedb_sidecar_get_section";
+	size_t section_data_offset                     = 0;
+	uint32_t section_data_size                     = 0;
+	uint32_t section_index                         = 0;
+	uint32_t value_32bit                           = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( section_index = 0;
+	     section_index < sidecar->number_of_sections;
+	     section_index++ )
+	{
+		section_header = (esedb_sidecar_section_header_t *) &( sidecar->sections_data[ section_data_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 section_header->data_size,
+		 section_data_size );
+
+		section_data_offset += sizeof( esedb_sidecar_section_header_t );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 section_header->section_type,
+		 value_32bit );
+
+		if( value_32bit == section_type )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 section_header->root_page_number,
+			 value_32bit );
+
+			if( value_32bit == root_page_number )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 section_header->number_of_entries,
+				 *number_of_entries );
+
+				*entries_data      = &( sidecar->sections_data[ section_data_offset ] );
+				*entries_data_size = (size_t) section_data_size;
+
+				return( 1 );
+			}
+		}
+		section_data_offset += section_data_size;
+	}
+	return( 0 );
+}
+
+/* Retrieves the next entry from the entries data of a section
+ * Returns 1 if successful, 0 if no more entries or -1 on error
+ */
+int libesedb_sidecar_get_next_entry(
+     const uint8_t *entries_data,
+     size_t entries_data_size,
+     size_t *entries_data_offset,
+     const uint8_t **entry_data,
+     size_t *entry_data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_sidecar_get_next_entry";
+	size_t safe_offset       = 0;
+	uint32_t safe_entry_size = 0;
+
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = *entries_data_offset;
+
+	if( safe_offset >= entries_data_size )
+	{
+		return( 0 );
+	}
+	if( ( entries_data_size - safe_offset ) < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entries data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entries_data[ safe_offset ] ),
+	 safe_entry_size );
+
+	safe_offset += 4;
+
+	if( (size_t) safe_entry_size > ( entries_data_size - safe_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry_data          = &( entries_data[ safe_offset ] );
+	*entry_data_size     = (size_t) safe_entry_size;
+	*entries_data_offset = safe_offset + safe_entry_size;
+
+	return( 1 );
+}
+
+/* Appends a new (empty) section
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_append_section(
+     libesedb_sidecar_t *sidecar,
+     uint32_t section_type,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_section_header_t *section_header = NULL;
+	static char *function                          = "libesedb_sidecar_append_section";
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->number_of_sections == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sidecar - number of sections value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_sidecar_resize_sections_data(
+	     sidecar,
+	     sidecar->sections_data_size + sizeof( esedb_sidecar_section_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sections data.",
+		 function );
+
+		return( -1 );
+	}
+	section_header = (esedb_sidecar_section_header_t *) &( sidecar->sections_data[ sidecar->sections_data_size ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->section_type,
+	 section_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->root_page_number,
+	 root_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->number_of_entries,
+	 0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->data_size,
+	 0 );
+
+	sidecar->last_section_offset = sidecar->sections_data_size;
+	sidecar->sections_data_size += sizeof( esedb_sidecar_section_header_t );
+
+	sidecar->number_of_sections += 1;
+
+	return( 1 );
+}
+
+/* Appends an entry to the last section
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_append_entry(
+     libesedb_sidecar_t *sidecar,
+     const uint8_t *entry_data,
+     size_t entry_data_size,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_section_header_t *section_header = NULL;
+	static char *function                          = "libesedb_sidecar_append_entry";
+	uint32_t number_of_entries                     = 0;
+	uint32_t section_data_size                     = 0;
+
+	if( sidecar == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar->number_of_sections == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sidecar - missing sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_data == NULL )
+	 && ( entry_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data_size > (size_t) ( LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE - sizeof( esedb_sidecar_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entry data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_sidecar_resize_sections_data(
+	     sidecar,
+	     sidecar->sections_data_size + 4 + entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sections data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( sidecar->sections_data[ sidecar->sections_data_size ] ),
+	 (uint32_t) entry_data_size );
+
+	if( entry_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( sidecar->sections_data[ sidecar->sections_data_size + 4 ] ),
+		     entry_data,
+		     entry_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	sidecar->sections_data_size += 4 + entry_data_size;
+
+	section_header = (esedb_sidecar_section_header_t *) &( sidecar->sections_data[ sidecar->last_section_offset ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 section_header->number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 section_header->data_size,
+	 section_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->number_of_entries,
+	 number_of_entries + 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 section_header->data_size,
+	 section_data_size + 4 + (uint32_t) entry_data_size );
+
+	return( 1 );
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Sidecar cache file functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_SIDECAR_H )
+#define _LIBESEDB_SIDECAR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a sidecar cache file
+ */
+#define LIBESEDB_SIDECAR_MAXIMUM_DATA_SIZE	( 256 * 1024 * 1024 )
+
+extern const uint8_t esedb_sidecar_signature[ 8 ];
+
+typedef struct libesedb_sidecar libesedb_sidecar_t;
+
+struct libesedb_sidecar
+{
+	/* The page size of the database file
+	 */
+	uint32_t page_size;
+
+	/* The size of the database file
+	 */
+	size64_t file_size;
+
+	/* The (stored) checksum of the database file header
+	 */
+	uint32_t file_header_checksum;
+
+	/* The database time of the database file header
+	 */
+	uint64_t database_time;
+
+	/* The sections data
+	 */
+	uint8_t *sections_data;
+
+	/* The sections data size
+	 */
+	size_t sections_data_size;
+
+	/* The allocated sections data size
+	 */
+	size_t allocated_sections_data_size;
+
+	/* The number of sections
+	 */
+	uint32_t number_of_sections;
+
+	/* The offset of the header of the last section in the sections data
+	 */
+	size_t last_section_offset;
+};
+
+int libesedb_sidecar_initialize(
+     libesedb_sidecar_t **sidecar,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_free(
+     libesedb_sidecar_t **sidecar,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_clear_sections(
+     libesedb_sidecar_t *sidecar,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_resize_sections_data(
+     libesedb_sidecar_t *sidecar,
+     size_t sections_data_size,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_read_data(
+     libesedb_sidecar_t *sidecar,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_read_file_io_handle(
+     libesedb_sidecar_t *sidecar,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_write_file_io_handle(
+     libesedb_sidecar_t *sidecar,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_get_section(
+     libesedb_sidecar_t *sidecar,
+     uint32_t section_type,
+     uint32_t root_page_number,
+     const uint8_t **entries_data,
+     size_t *entries_data_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_get_next_entry(
+     const uint8_t *entries_data,
+     size_t entries_data_size,
+     size_t *entries_data_offset,
+     const uint8_t **entry_data,
+     size_t *entry_data_size,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_append_section(
+     libesedb_sidecar_t *sidecar,
+     uint32_t section_type,
+     uint32_t root_page_number,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_append_entry(
+     libesedb_sidecar_t *sidecar,
+     const uint8_t *entry_data,
+     size_t entry_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_SIDECAR_H ) */
+
@@ -506,7 +506,8 @@ int libesedb_space_tree_read_values_from_page(
 
 				goto on_error;
 			}
-			total_number_of_pages += space_tree_value->number_of_pages;
+			total_number_of_pages       += space_tree_value->number_of_pages;
+			space_tree->number_of_pages += space_tree_value->number_of_pages;
 
 			if( libesedb_space_tree_value_free(
 			     &space_tree_value,
@@ -602,13 +603,13 @@ int libesedb_space_tree_read_values_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= space_tree->page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
+				if( libesedb_page_get_from_pages_vector(
 				     space_tree->page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				     file_io_handle,
+				     child_page_cache,
+				     space_tree->page_tree->io_handle,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -752,6 +753,8 @@ int libesedb_space_tree_read_file_io_handle(
 
 		return( -1 );
 	}
+	space_tree->number_of_pages = 0;
+
         /* Use a local cache to prevent cache invalidation of the root page
          * when reading child pages.
          */
@@ -769,13 +772,13 @@ int libesedb_space_tree_read_file_io_handle(
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
+	if( libesedb_page_get_from_pages_vector(
 	     space_tree->page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) space_tree->page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	     file_io_handle,
+	     root_page_cache,
+	     space_tree->page_tree->io_handle,
+	     space_tree->page_tree->root_page_number,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
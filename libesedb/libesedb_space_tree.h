@@ -43,6 +43,10 @@ struct libesedb_space_tree
 	/* The page tree
 	 */
 	libesedb_page_tree_t *page_tree;
+
+	/* The total number of pages of the space tree values
+	 */
+	uint64_t number_of_pages;
 };
 
 int libesedb_space_tree_initialize(
@@ -24,21 +24,30 @@
 #include <types.h>
 
 #include "libesedb_column.h"
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
 #include "libesedb_index.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_leaf_page_descriptor.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
+#include "libesedb_record_cursor.h"
+#include "libesedb_record_filter.h"
+#include "libesedb_scan_worker.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
+#include "esedb_page_values.h"
+
 /* Creates a table
  * Make sure the value table is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -47,13 +56,14 @@ int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_initialize";
-	int segment_index                         = 0;
 
 	if( table == NULL )
 	{
@@ -141,65 +151,11 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
-		 function );
-
-		goto on_error;
-	}
 	if( libesedb_page_tree_initialize(
 	     &( internal_table->table_page_tree ),
 	     io_handle,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
+	     pages_vector,
+	     pages_cache,
 	     table_definition->table_catalog_definition->identifier,
 	     table_definition->table_catalog_definition->father_data_page_number,
 	     table_definition,
@@ -217,65 +173,11 @@ int libesedb_table_initialize(
 	}
 	if( table_definition->long_value_catalog_definition != NULL )
 	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_initialize(
 		     &( internal_table->long_values_page_tree ),
 		     io_handle,
-		     internal_table->long_values_pages_vector,
-		     internal_table->long_values_pages_cache,
+		     pages_vector,
+		     pages_cache,
 		     table_definition->long_value_catalog_definition->identifier,
 		     table_definition->long_value_catalog_definition->father_data_page_number,
 		     table_definition,
@@ -292,11 +194,47 @@ int libesedb_table_initialize(
 			goto on_error;
 		}
 	}
+	if( libesedb_column_projection_initialize(
+	     &( internal_table->column_projection ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column projection.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_column_map_initialize(
+	     &( internal_table->column_map ),
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column map.",
+		 function );
+
+		goto on_error;
+	}
 	internal_table->io_handle                 = io_handle;
 	internal_table->file_io_handle            = file_io_handle;
+	internal_table->pages_vector              = pages_vector;
+	internal_table->pages_cache               = pages_cache;
 	internal_table->table_definition          = table_definition;
 	internal_table->template_table_definition = template_table_definition;
 
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		internal_table->long_values_pages_vector = pages_vector;
+		internal_table->long_values_pages_cache  = pages_cache;
+	}
+
 	*table = (libesedb_table_t *) internal_table;
 
 	return( 1 );
@@ -304,16 +242,16 @@ int libesedb_table_initialize(
 on_error:
 	if( internal_table != NULL )
 	{
-		if( internal_table->long_values_pages_cache != NULL )
+		if( internal_table->column_map != NULL )
 		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
+			libesedb_column_map_free(
+			 &( internal_table->column_map ),
 			 NULL );
 		}
-		if( internal_table->long_values_pages_vector != NULL )
+		if( internal_table->column_projection != NULL )
 		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
+			libesedb_column_projection_free(
+			 &( internal_table->column_projection ),
 			 NULL );
 		}
 		if( internal_table->long_values_page_tree != NULL )
@@ -328,18 +266,6 @@ on_error:
 			 &( internal_table->table_page_tree ),
 			 NULL );
 		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
 		memory_free(
 		 internal_table );
 	}
@@ -373,92 +299,76 @@ int libesedb_table_free(
 		internal_table = (libesedb_internal_table_t *) *table;
 		*table         = NULL;
 
-		/* The io_handle, file_io_handle and table_definition references
-		 * are freed elsewhere
+		/* The io_handle, file_io_handle, pages_vector, pages_cache and table_definition
+		 * references are freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
+		if( internal_table->long_values_page_tree != NULL )
+		{
+			if( libesedb_page_tree_free(
+			     &( internal_table->long_values_page_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values page tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libesedb_page_tree_free(
+		     &( internal_table->table_page_tree ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
+			 "%s: unable to free table page tree.",
 			 function );
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
+		if( libesedb_column_projection_free(
+		     &( internal_table->column_projection ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
+			 "%s: unable to free column projection.",
 			 function );
 
 			result = -1;
 		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_page_tree != NULL )
+		if( internal_table->record_filter != NULL )
 		{
-			if( libesedb_page_tree_free(
-			     &( internal_table->long_values_page_tree ),
+			if( libesedb_record_filter_free(
+			     (libesedb_record_filter_t **) &( internal_table->record_filter ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values page tree.",
+				 "%s: unable to free record filter.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( libesedb_page_tree_free(
-		     &( internal_table->table_page_tree ),
+		if( libesedb_column_map_free(
+		     &( internal_table->column_map ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table page tree.",
+			 "%s: unable to free column map.",
 			 function );
 
 			result = -1;
@@ -1288,16 +1198,19 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
-/* Retrieves the number of indexes
- * Returns 1 if successful or -1 on error
+/* Retrieves the column entry of the column with a specific identifier
+ * The column entry includes the columns of the template table
+ * Returns 1 if successful, 0 if no such column or -1 on error
  */
-int libesedb_table_get_number_of_indexes(
+int libesedb_table_get_column_entry_by_identifier(
      libesedb_table_t *table,
-     int *number_of_indexes,
+     uint32_t column_identifier,
+     int *column_entry,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
-	static char *function                     = "libesedb_table_get_number_of_indexes";
+	static char *function                     = "libesedb_table_get_column_entry_by_identifier";
+	int result                                = 0;
 
 	if( table == NULL )
 	{
@@ -1312,35 +1225,51 @@ int libesedb_table_get_number_of_indexes(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libesedb_table_definition_get_number_of_index_catalog_definitions(
-	     internal_table->table_definition,
-	     number_of_indexes,
-	     error ) != 1 )
+	if( internal_table->column_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing column map.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          internal_table->column_map,
+	          column_identifier,
+	          column_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of indexes.",
+		 "%s: unable to retrieve column entry from column map.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves a specific index
- * Returns 1 if successful or -1 on error
+/* Retrieves the column entry of the column with a specific UTF-8 encoded name
+ * The column entry includes the columns of the template table
+ * Returns 1 if successful, 0 if no such column or -1 on error
  */
-int libesedb_table_get_index(
+int libesedb_table_get_column_entry_by_utf8_name(
      libesedb_table_t *table,
-     int index_entry,
-     libesedb_index_t **index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
      libcerror_error_t **error )
 {
-	libesedb_internal_table_t *internal_table               = NULL;
-	libesedb_catalog_definition_t *index_catalog_definition = NULL;
-	static char *function                                   = "libesedb_table_get_index";
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_column_entry_by_utf8_name";
+	int result                                = 0;
 
 	if( table == NULL )
 	{
@@ -1355,80 +1284,108 @@ int libesedb_table_get_index(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( index == NULL )
+	if( internal_table->column_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing column map.",
 		 function );
 
 		return( -1 );
 	}
-	if( *index != NULL )
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          internal_table->column_map,
+	          utf8_string,
+	          utf8_string_length,
+	          column_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid index value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column entry from column map.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_table_definition_get_index_catalog_definition_by_index(
-	     internal_table->table_definition,
-	     index_entry,
-	     &index_catalog_definition,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Retrieves the column entry of the column with a specific UTF-16 encoded name
+ * The column entry includes the columns of the template table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_entry_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *column_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_column_entry_by_utf16_name";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->column_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index catalog definition.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing column map.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_index_initialize(
-	     index,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     index_catalog_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
-	     internal_table->table_page_tree,
-	     internal_table->long_values_page_tree,
-	     error ) != 1 )
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          internal_table->column_map,
+	          utf16_string,
+	          utf16_string_length,
+	          column_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create index.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column entry from column map.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the number of records in the table
+/* Retrieves the number of indexes
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_number_of_records(
+int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
-     int *number_of_records,
+     int *number_of_indexes,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
-	static char *function                     = "libesedb_table_get_number_of_records";
+	static char *function                     = "libesedb_table_get_number_of_indexes";
 
 	if( table == NULL )
 	{
@@ -1443,17 +1400,108 @@ int libesedb_table_get_number_of_records(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libesedb_page_tree_get_number_of_leaf_values(
-	     internal_table->table_page_tree,
-	     internal_table->file_io_handle,
-	     number_of_records,
-	     error ) != 1 )
+	if( libesedb_table_definition_get_number_of_index_catalog_definitions(
+	     internal_table->table_definition,
+	     number_of_indexes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_index(
+     libesedb_table_t *table,
+     int index_entry,
+     libesedb_index_t **index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	static char *function                                   = "libesedb_table_get_index";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_definition_get_index_catalog_definition_by_index(
+	     internal_table->table_definition,
+	     index_entry,
+	     &index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_initialize(
+	     index,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     index_catalog_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     internal_table->table_page_tree,
+	     internal_table->long_values_page_tree,
+	     internal_table->column_projection,
+	     internal_table->column_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
 		 function );
 
 		return( -1 );
@@ -1461,6 +1509,146 @@ int libesedb_table_get_number_of_records(
 	return( 1 );
 }
 
+/* Retrieves the number of records in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_number_of_records(
+     libesedb_table_t *table,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_number_of_records";
+	int result                                = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the estimated number of records in the table
+ * The estimate is determined from a few branch pages and the space tree of the table,
+ * without reading all the leaf pages, and is exact once all the records have been counted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_estimated_number_of_records(
+     libesedb_table_t *table,
+     uint64_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_estimated_number_of_records";
+	int result                                = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_estimated_number_of_leaf_values(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve estimated number of leaf values from table page tree.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
@@ -1509,6 +1697,19 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_tree_get_leaf_value_by_index(
 	     internal_table->table_page_tree,
 	     internal_table->file_io_handle,
@@ -1538,6 +1739,9 @@ int libesedb_table_get_record(
 	     internal_table->long_values_pages_cache,
 	     record_data_definition,
 	     internal_table->long_values_page_tree,
+	     internal_table->column_projection,
+	     NULL,
+	     internal_table->column_map,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1550,9 +1754,30 @@ int libesedb_table_get_record(
 
 		goto on_error;
 	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		libesedb_record_free(
+		 record,
+		 NULL );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
+	libesedb_io_handle_release_for_write(
+	 internal_table->io_handle,
+	 NULL );
+
 	if( record_data_definition != NULL )
 	{
 		libesedb_data_definition_free(
@@ -1562,3 +1787,1375 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a record cursor to read the records in sequence
+ * The record cursor references the table and must be freed before the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record_cursor(
+     libesedb_table_t *table,
+     libesedb_record_cursor_t **record_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_record_cursor";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_record_cursor_initialize(
+	     record_cursor,
+	     internal_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the column projection
+ * The column projection restricts the values read by records retrieved
+ * from the table, its indexes and record cursors to the columns with the
+ * specified identifiers, other column values are read as empty values
+ * Setting 0 column identifiers clears the column projection
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_set_column_projection";
+	int result                                = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	/* The column projection is used while reading records
+	 */
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_column_projection_set_column_identifiers(
+	     internal_table->column_projection,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     column_identifiers,
+	     number_of_column_identifiers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set column identifiers of column projection.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Creates a record filter for the records of the table
+ * The conditions of the record filter refer to the column entries of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_create_record_filter(
+     libesedb_table_t *table,
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_create_record_filter";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_record_filter_initialize(
+	     record_filter,
+	     internal_table->column_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record filter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the record filter
+ * The record filter is evaluated on the stored column data of the records read by
+ * record cursors and libesedb_table_scan_records, records that do not match are skipped
+ * before any of their values are created
+ * The table uses a copy of the record filter, setting NULL clears the record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_set_record_filter(
+     libesedb_table_t *table,
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_filter_t *internal_record_filter = NULL;
+	libesedb_internal_table_t *internal_table                 = NULL;
+	libesedb_record_filter_t *safe_record_filter              = NULL;
+	static char *function                                     = "libesedb_table_set_record_filter";
+	int result                                                = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record_filter != NULL )
+	{
+		internal_record_filter = (libesedb_internal_record_filter_t *) record_filter;
+
+		if( internal_record_filter->column_map != internal_table->column_map )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported record filter - not created for this table.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( internal_record_filter->number_of_conditions > 0 )
+		 && ( internal_record_filter->number_of_operands != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported record filter - incomplete expression.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_record_filter_clone(
+		     &safe_record_filter,
+		     record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The record filter is used while reading records
+	 */
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_table->record_filter != NULL )
+	{
+		if( libesedb_record_filter_free(
+		     (libesedb_record_filter_t **) &( internal_table->record_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record filter.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_table->record_filter = (libesedb_internal_record_filter_t *) safe_record_filter;
+	safe_record_filter            = NULL;
+
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( safe_record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &safe_record_filter,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans all the records of the table using multiple threads
+ * The leaf pages of the table are divided in consecutive ranges, one per thread,
+ * where every thread uses its own file IO handle and pages cache
+ * The callback function is called for every record from the thread that read it,
+ * it returns 1 to continue, 0 to stop the thread or -1 on error
+ * The record is freed after the callback function returns
+ * Records rejected by the record filter of the table are skipped
+ * Without multi-thread support the records are scanned by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_scan_records(
+     libesedb_table_t *table,
+     int number_of_threads,
+     int (*callback_function)(
+            libesedb_record_t *record,
+            int thread_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *leaf_page_descriptors_array = NULL;
+	libcdata_array_t *scan_workers_array          = NULL;
+	libesedb_internal_table_t *internal_table     = NULL;
+	libesedb_scan_worker_t *scan_worker           = NULL;
+	static char *function                         = "libesedb_table_scan_records";
+	uint8_t io_handle_grabbed                     = 0;
+	int first_leaf_page_index                     = 0;
+	int number_of_leaf_pages                      = 0;
+	int number_of_worker_leaf_pages               = 0;
+	int number_of_workers                         = 0;
+	int result                                    = 1;
+	int worker_index                              = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle_grabbed = 1;
+
+	/* The leaf pages are retrieved and the file IO handle is cloned
+	 * while access to the IO handle is serialized
+	 */
+	if( libcdata_array_initialize(
+	     &leaf_page_descriptors_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf page descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_leaf_page_descriptors(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     leaf_page_descriptors_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptors from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     leaf_page_descriptors_array,
+	     &number_of_leaf_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf page descriptors.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = number_of_threads;
+
+	if( number_of_workers > number_of_leaf_pages )
+	{
+		number_of_workers = number_of_leaf_pages;
+	}
+#else
+	if( number_of_leaf_pages > 0 )
+	{
+		number_of_workers = 1;
+	}
+#endif
+	if( libcdata_array_initialize(
+	     &scan_workers_array,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan workers array.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		/* Distribute the remainder of the leaf pages over the first workers
+		 */
+		number_of_worker_leaf_pages = number_of_leaf_pages / number_of_workers;
+
+		if( worker_index < ( number_of_leaf_pages % number_of_workers ) )
+		{
+			number_of_worker_leaf_pages += 1;
+		}
+		if( libesedb_scan_worker_initialize(
+		     &scan_worker,
+		     worker_index,
+		     internal_table->file_io_handle,
+		     internal_table->io_handle,
+		     internal_table->table_definition,
+		     internal_table->template_table_definition,
+		     internal_table->column_projection,
+		     internal_table->column_map,
+		     internal_table->record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     scan_workers_array,
+		     worker_index,
+		     (intptr_t *) scan_worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan worker: %d in array.",
+			 function,
+			 worker_index );
+
+			libesedb_scan_worker_free(
+			 &scan_worker,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libesedb_scan_worker_set_leaf_pages(
+		     scan_worker,
+		     leaf_page_descriptors_array,
+		     first_leaf_page_index,
+		     number_of_worker_leaf_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf pages of scan worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libesedb_scan_worker_set_callback(
+		     scan_worker,
+		     callback_function,
+		     callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set callback of scan worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		first_leaf_page_index += number_of_worker_leaf_pages;
+
+		scan_worker = NULL;
+	}
+	io_handle_grabbed = 0;
+
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_workers_array,
+		     worker_index,
+		     (intptr_t **) &scan_worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_workers > 1 )
+		{
+			if( libcthreads_thread_create(
+			     &( scan_worker->thread ),
+			     NULL,
+			     (int (*)(void *)) &libesedb_scan_worker_run,
+			     (void *) scan_worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of scan worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		libesedb_scan_worker_run(
+		 scan_worker );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_workers_array,
+		     worker_index,
+		     (intptr_t **) &scan_worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( LIBESEDB_HAVE_MULTI_THREAD_SUPPORT )
+		if( scan_worker->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( scan_worker->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of scan worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* Report the error of the first scan worker that failed
+		 */
+		if( ( scan_worker->result == -1 )
+		 && ( result != -1 ) )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = scan_worker->error;
+
+				scan_worker->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan records in scan worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_free(
+	     &scan_workers_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_scan_worker_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan workers array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_free(
+	     &leaf_page_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_leaf_page_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free leaf page descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( io_handle_grabbed != 0 )
+	{
+		libesedb_io_handle_release_for_write(
+		 internal_table->io_handle,
+		 NULL );
+	}
+	/* Freeing the scan workers joins the threads that were created
+	 */
+	if( scan_workers_array != NULL )
+	{
+		libcdata_array_free(
+		 &scan_workers_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_scan_worker_free,
+		 NULL );
+	}
+	if( leaf_page_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &leaf_page_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_leaf_page_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the identifier, value data offset and size of a specific fixed size column
+ * The value data offset is relative to the start of the record data
+ * The column catalog definitions are stored in order of identifier, hence
+ * the value data of a fixed size column follows that of the preceding fixed size columns
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_table_get_fixed_size_column(
+     libesedb_internal_table_t *internal_table,
+     int column_entry,
+     uint32_t *column_identifier,
+     uint16_t *value_data_offset,
+     uint16_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_internal_table_get_fixed_size_column";
+	size_t safe_value_data_offset                            = 0;
+	int column_catalog_definition_index                      = 0;
+	int template_table_number_of_columns                     = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid column entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->template_table_definition != NULL )
+	{
+		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+		     internal_table->template_table_definition,
+		     &template_table_number_of_columns,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_value_data_offset = sizeof( esedb_data_definition_header_t );
+
+	for( column_catalog_definition_index = 0;
+	     column_catalog_definition_index <= column_entry;
+	     column_catalog_definition_index++ )
+	{
+		if( column_catalog_definition_index < template_table_number_of_columns )
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     internal_table->template_table_definition,
+			     column_catalog_definition_index,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from template table.",
+				 function,
+				 column_catalog_definition_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libesedb_table_definition_get_column_catalog_definition_by_index(
+			     internal_table->table_definition,
+			     column_catalog_definition_index - template_table_number_of_columns,
+			     &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from table.",
+				 function,
+				 column_catalog_definition_index );
+
+				return( -1 );
+			}
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_catalog_definition_index );
+
+			return( -1 );
+		}
+		if( column_catalog_definition->identifier > 127 )
+		{
+			continue;
+		}
+		if( column_catalog_definition_index < column_entry )
+		{
+			safe_value_data_offset += column_catalog_definition->size;
+		}
+	}
+	if( ( column_catalog_definition->identifier == 0 )
+	 || ( column_catalog_definition->identifier > 127 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column: %d - not a fixed size column.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	if( ( column_catalog_definition->size == 0 )
+	 || ( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+	 || ( ( safe_value_data_offset + column_catalog_definition->size ) > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column: %d - size value out of bounds.",
+		 function,
+		 column_entry );
+
+		return( -1 );
+	}
+	*column_identifier = column_catalog_definition->identifier;
+	*value_data_offset = (uint16_t) safe_value_data_offset;
+	*value_data_size   = (uint16_t) column_catalog_definition->size;
+
+	return( 1 );
+}
+
+/* Reads the values of a specific fixed size column of a range of records
+ * The value data of the records is stored consecutively in values, where
+ * the value of every record has the size of the column, in little-endian
+ * The null bitmap contains a bit per record, where the least significant
+ * bit of the first byte corresponds with the first record, that is set if
+ * the record has no value for the column. The value data of such records is zeroed
+ * The value data is read directly from the pages without creating records
+ * A leaf page chain that is longer than the number of pages in the file contains a cycle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_read_column_batch(
+     libesedb_table_t *table,
+     int column_entry,
+     int first_record_entry,
+     int number_of_records,
+     uint8_t *values,
+     size_t values_size,
+     uint8_t *null_bitmap,
+     size_t null_bitmap_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	libesedb_page_t *leaf_page                         = NULL;
+	const uint8_t *value_data                          = NULL;
+	static char *function                              = "libesedb_table_read_column_batch";
+	size_t values_offset                               = 0;
+	uint32_t column_identifier                         = 0;
+	uint32_t leaf_page_number                          = 0;
+	uint32_t number_of_leaf_pages                      = 0;
+	uint16_t number_of_page_values                     = 0;
+	uint16_t page_value_index                          = 0;
+	uint16_t value_data_offset                         = 0;
+	uint16_t value_data_size                           = 0;
+	uint8_t has_leaf_value                             = 0;
+	int number_of_leaf_values                          = 0;
+	int record_index                                   = 0;
+	int result                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of records value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid values size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( null_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid null bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( null_bitmap_size < ( ( (size_t) number_of_records + 7 ) / 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid null bitmap size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_grab_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_table_get_fixed_size_column(
+	     internal_table,
+	     column_entry,
+	     &column_identifier,
+	     &value_data_offset,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve fixed size column: %d.",
+		 function,
+		 column_entry );
+
+		goto on_error;
+	}
+	if( (size_t) number_of_records > ( values_size / value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid values size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_records - 1 ) > ( INT_MAX - first_record_entry ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry or number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the leaf pages up to the one that contains the last record are read
+	 */
+	if( libesedb_page_tree_read_leaf_page_descriptors(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     first_record_entry + number_of_records - 1,
+	     &number_of_leaf_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read leaf page descriptors from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( first_record_entry >= number_of_leaf_values )
+	 || ( number_of_records > ( number_of_leaf_values - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry or number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     null_bitmap,
+	     0,
+	     ( (size_t) number_of_records + 7 ) / 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear null bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the first record is looked up by index, the following records
+	 * are read in sequence from the leaf pages into the same data definition
+	 */
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     first_record_entry,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 first_record_entry );
+
+		goto on_error;
+	}
+	leaf_page_number     = record_data_definition->page_number;
+	page_value_index     = record_data_definition->page_value_index;
+	number_of_leaf_pages = 1;
+	has_leaf_value       = 1;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		while( has_leaf_value == 0 )
+		{
+			if( ( leaf_page_number == 0 )
+			 || ( leaf_page_number > internal_table->io_handle->last_page_number )
+			 || ( leaf_page_number > (uint32_t) INT_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid leaf page number value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_get_from_pages_vector(
+			     internal_table->pages_vector,
+			     internal_table->file_io_handle,
+			     internal_table->pages_cache,
+			     internal_table->io_handle,
+			     leaf_page_number,
+			     &leaf_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 leaf_page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_get_number_of_values(
+			     leaf_page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				goto on_error;
+			}
+			page_value_index++;
+
+			if( page_value_index < number_of_page_values )
+			{
+				result = libesedb_page_tree_read_leaf_value_from_leaf_page(
+				          internal_table->table_page_tree,
+				          leaf_page,
+				          page_value_index,
+				          record_data_definition,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve leaf value: %" PRIu16 " from page: %" PRIu32 ".",
+					 function,
+					 page_value_index,
+					 leaf_page_number );
+
+					goto on_error;
+				}
+				has_leaf_value = (uint8_t) result;
+			}
+			else
+			{
+				if( libesedb_page_get_next_page_number(
+				     leaf_page,
+				     &leaf_page_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve next page number.",
+					 function );
+
+					goto on_error;
+				}
+				if( leaf_page_number != 0 )
+				{
+					if( number_of_leaf_pages >= internal_table->io_handle->last_page_number )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid next page number: %" PRIu32 " - leaf pages contain a cycle.",
+						 function,
+						 leaf_page_number );
+
+						goto on_error;
+					}
+					number_of_leaf_pages += 1;
+				}
+				page_value_index = 0;
+			}
+		}
+		result = libesedb_data_definition_read_fixed_size_value_data(
+		          record_data_definition,
+		          internal_table->file_io_handle,
+		          internal_table->io_handle,
+		          internal_table->pages_vector,
+		          internal_table->pages_cache,
+		          column_identifier,
+		          value_data_offset,
+		          value_data_size,
+		          &value_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value data of record: %d.",
+			 function,
+			 first_record_entry + record_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( memory_copy(
+			     &( values[ values_offset ] ),
+			     value_data,
+			     (size_t) value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data of record: %d.",
+				 function,
+				 first_record_entry + record_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( memory_set(
+			     &( values[ values_offset ] ),
+			     0,
+			     (size_t) value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear value data of record: %d.",
+				 function,
+				 first_record_entry + record_index );
+
+				goto on_error;
+			}
+			null_bitmap[ record_index / 8 ] |= (uint8_t) ( 1 << ( record_index % 8 ) );
+		}
+		values_offset += value_data_size;
+
+		has_leaf_value = 0;
+	}
+	if( libesedb_data_definition_free(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_io_handle_release_for_write(
+	     internal_table->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release IO handle for write.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	libesedb_io_handle_release_for_write(
+	 internal_table->io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_column_map.h"
+#include "libesedb_column_projection.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
@@ -32,6 +34,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_record_filter.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -60,18 +63,22 @@ struct libesedb_internal_table
 	libesedb_table_definition_t *template_table_definition;
 
 	/* The pages vector
+	 * the pages vector is shared with the file
 	 */
 	libfdata_vector_t *pages_vector;
 
 	/* The pages cache
+	 * the pages cache is shared with the file
 	 */
 	libfcache_cache_t *pages_cache;
 
 	/* The long values pages vector
+	 * the long values pages vector is shared with the file
 	 */
 	libfdata_vector_t *long_values_pages_vector;
 
 	/* The long values pages cache
+	 * the long values pages cache is shared with the file
 	 */
 	libfcache_cache_t *long_values_pages_cache;
 
@@ -82,12 +89,26 @@ struct libesedb_internal_table
 	/* The long values page tree
 	 */
 	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The column projection
+	 */
+	libesedb_column_projection_t *column_projection;
+
+	/* The column map
+	 */
+	libesedb_column_map_t *column_map;
+
+	/* The record filter
+	 */
+	libesedb_internal_record_filter_t *record_filter;
 };
 
 int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcerror_error_t **error );
@@ -170,6 +191,29 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_entry_by_identifier(
+     libesedb_table_t *table,
+     uint32_t column_identifier,
+     int *column_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_entry_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *column_entry,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_entry_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int *column_entry,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -189,6 +233,12 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_estimated_number_of_records(
+     libesedb_table_t *table,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -196,6 +246,63 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_cursor(
+     libesedb_table_t *table,
+     libesedb_record_cursor_t **record_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_create_record_filter(
+     libesedb_table_t *table,
+     libesedb_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_set_record_filter(
+     libesedb_table_t *table,
+     libesedb_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_scan_records(
+     libesedb_table_t *table,
+     int number_of_threads,
+     int (*callback_function)(
+            libesedb_record_t *record,
+            int thread_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libesedb_internal_table_get_fixed_size_column(
+     libesedb_internal_table_t *internal_table,
+     int column_entry,
+     uint32_t *column_identifier,
+     uint16_t *value_data_offset,
+     uint16_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_read_column_batch(
+     libesedb_table_t *table,
+     int column_entry,
+     int first_record_entry,
+     int number_of_records,
+     uint8_t *values,
+     size_t values_size,
+     uint8_t *null_bitmap,
+     size_t null_bitmap_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -96,6 +96,14 @@ PyMethodDef pyesedb_table_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific record" },
 
+	{ "set_column_projection",
+	  (PyCFunction) pyesedb_table_set_column_projection,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_column_projection(column_identifiers) -> None\n"
+	  "\n"
+	  "Sets the column projection, restricting the values read by records to the columns\n"
+	  "with the specified identifiers. An empty sequence clears the column projection." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -1116,3 +1124,160 @@ PyObject *pyesedb_table_get_records(
 	return( records_object );
 }
 
+/* Sets the column projection
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_set_column_projection(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *identifier_object        = NULL;
+	PyObject *identifiers_object       = NULL;
+	PyObject *sequence_object          = NULL;
+	libcerror_error_t *error           = NULL;
+	uint32_t *column_identifiers       = NULL;
+	static char *function              = "pyesedb_table_set_column_projection";
+	static char *keyword_list[]        = { "column_identifiers", NULL };
+	uint64_t column_identifier         = 0;
+	Py_ssize_t identifier_index        = 0;
+	Py_ssize_t number_of_identifiers   = 0;
+	int result                         = 0;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &identifiers_object ) == 0 )
+	{
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   identifiers_object,
+	                   "column identifiers must be a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_identifiers = PySequence_Fast_GET_SIZE(
+	                         sequence_object );
+
+	if( number_of_identifiers > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of column identifiers value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_identifiers > 0 )
+	{
+		column_identifiers = (uint32_t *) PyMem_Malloc(
+		                                   sizeof( uint32_t ) * (size_t) number_of_identifiers );
+
+		if( column_identifiers == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create column identifiers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		identifier_object = PySequence_Fast_GET_ITEM(
+		                     sequence_object,
+		                     identifier_index );
+
+		if( pyesedb_integer_unsigned_copy_to_64bit(
+		     identifier_object,
+		     &column_identifier,
+		     &error ) != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert column identifier: %d into 64-bit value.",
+			 function,
+			 (int) identifier_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		if( column_identifier > (uint64_t) UINT32_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid column identifier: %d value exceeds maximum.",
+			 function,
+			 (int) identifier_index );
+
+			goto on_error;
+		}
+		column_identifiers[ identifier_index ] = (uint32_t) column_identifier;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_set_column_projection(
+	          pyesedb_table->table,
+	          column_identifiers,
+	          (int) number_of_identifiers,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set column projection.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( column_identifiers != NULL )
+	{
+		PyMem_Free(
+		 column_identifiers );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	if( column_identifiers != NULL )
+	{
+		PyMem_Free(
+		 column_identifiers );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
@@ -105,6 +105,11 @@ PyObject *pyesedb_table_get_record(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyesedb_table_set_column_projection(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyesedb_table_get_records(
            pyesedb_table_t *pyesedb_table,
            PyObject *arguments );
@@ -0,0 +1,1626 @@
+/*
+ * Library benchmarking program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_compression.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+
+#if defined( HAVE_LZXPRESS_FALLBACK )
+#include "../libesedb/libesedb_libfwnt.h"
+#endif
+
+#include "../libesedb/libesedb_lzxpress.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_header.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_page_tree_value.h"
+
+/* This program is not part of the test suite, it reports the time taken
+ * by performance sensitive parts of the library on generated data
+ */
+
+#define ESEDB_TEST_BENCHMARK_PAGE_SIZE			4096
+#define ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS		20000
+
+/* A sidecar entry that contains the catalog definition of a table named Table000000
+ */
+uint8_t esedb_test_benchmark_catalog_entry_data[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00,
+	0x00, 0x00, 0xff, 0x00, 0x0b, 0x00, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Determines the number of nanoseconds per operation since a specific start time
+ */
+double esedb_test_benchmark_get_nanoseconds_per_operation(
+        clock_t start_time,
+        int number_of_operations )
+{
+	double elapsed_time = 0.0;
+
+	elapsed_time = (double) ( clock() - start_time ) / (double) CLOCKS_PER_SEC;
+
+	return( ( elapsed_time * 1000000000.0 ) / (double) number_of_operations );
+}
+
+/* Fills page data with a leaf page of a specific number of page values
+ * Page value 0 is empty, the other page values have a 4-byte key of twice
+ * their page value index in big-endian followed by 4 bytes of data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_set_leaf_page_data(
+     uint8_t *page_data,
+     size_t page_data_size,
+     uint16_t number_of_page_values )
+{
+	size_t page_values_data_size = 0;
+	uint16_t page_value_index    = 0;
+	uint16_t page_value_offset   = 0;
+	uint16_t page_value_size     = 0;
+
+	if( page_data == NULL )
+	{
+		return( -1 );
+	}
+	page_values_data_size = ( (size_t) number_of_page_values - 1 ) * 10;
+
+	if( ( number_of_page_values == 0 )
+	 || ( ( 40 + page_values_data_size + ( 4 * (size_t) number_of_page_values ) ) > page_data_size ) )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     page_data,
+	     0,
+	     page_data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	for( page_value_index = 0;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( page_value_index > 0 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( page_data[ 40 + page_value_offset ] ),
+			 4 );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( page_data[ 40 + page_value_offset + 2 ] ),
+			 (uint32_t) page_value_index * 2 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( page_data[ 40 + page_value_offset + 6 ] ),
+			 (uint32_t) page_value_index );
+
+			page_value_size = 10;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_data[ page_data_size - ( 4 * ( (size_t) page_value_index + 1 ) ) ] ),
+		 page_value_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_data[ page_data_size - ( 4 * ( (size_t) page_value_index + 1 ) ) + 2 ] ),
+		 page_value_offset );
+
+		page_value_offset += page_value_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 4 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 (uint16_t) ( page_data_size - 40 - page_values_data_size - ( 4 * (size_t) number_of_page_values ) ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 (uint16_t) page_values_data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_page_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 LIBESEDB_PAGE_FLAG_IS_LEAF );
+
+	return( 1 );
+}
+
+/* Benchmarks looking up keys in the page values of a leaf page
+ * The linear scan compares the key with every page value from the first one,
+ * as libesedb_page_tree_get_leaf_value_by_key_from_page did before it used
+ * libesedb_page_tree_get_first_page_value_index_by_key
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_page_tree_get_first_page_value_index_by_key(
+     uint16_t number_of_page_values )
+{
+	uint8_t key_data[ 4 ] = { 0, 0, 0, 0 };
+	uint8_t page_data[ ESEDB_TEST_BENCHMARK_PAGE_SIZE ];
+
+	libcerror_error_t *error                    = NULL;
+	libesedb_io_handle_t *io_handle             = NULL;
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_t *page_tree             = NULL;
+	libesedb_page_tree_key_t *key               = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	clock_t start_time                          = 0;
+	double binary_search_time                   = 0.0;
+	double linear_scan_time                     = 0.0;
+	uint16_t expected_page_value_index          = 0;
+	uint16_t page_value_index                   = 0;
+	int compare_result                          = 0;
+	int lookup_index                            = 0;
+	int result                                  = 0;
+
+	/* Initialize benchmark
+	 */
+	result = esedb_test_benchmark_set_leaf_page_data(
+	          page_data,
+	          ESEDB_TEST_BENCHMARK_PAGE_SIZE,
+	          number_of_page_values );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = ESEDB_TEST_BENCHMARK_PAGE_SIZE;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_header_read_data(
+	          page->header,
+	          io_handle,
+	          page_data,
+	          ESEDB_TEST_BENCHMARK_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_read_values(
+	          page,
+	          io_handle,
+	          page_data,
+	          ESEDB_TEST_BENCHMARK_PAGE_SIZE,
+	          page->header->data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	key->type = LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT;
+
+	/* The key data is overwritten for every lookup
+	 */
+	result = libesedb_page_tree_key_set_data(
+	          key,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Benchmark the linear scan
+	 */
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		expected_page_value_index = 1 + (uint16_t) ( lookup_index % ( number_of_page_values - 1 ) );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 key->data,
+		 (uint32_t) expected_page_value_index * 2 );
+
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			result = libesedb_page_tree_compare_key_with_page_value(
+			          page_tree,
+			          page,
+			          LIBESEDB_PAGE_FLAG_IS_LEAF,
+			          page_value_index,
+			          key,
+			          &page_value,
+			          &page_tree_value,
+			          &compare_result,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libesedb_page_tree_value_free(
+			          &page_tree_value,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			if( compare_result != LIBFDATA_COMPARE_GREATER )
+			{
+				break;
+			}
+		}
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "page_value_index",
+		 page_value_index,
+		 expected_page_value_index );
+	}
+	linear_scan_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                    start_time,
+	                    ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS );
+
+	/* Benchmark the binary search
+	 */
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		expected_page_value_index = 1 + (uint16_t) ( lookup_index % ( number_of_page_values - 1 ) );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 key->data,
+		 (uint32_t) expected_page_value_index * 2 );
+
+		result = libesedb_page_tree_get_first_page_value_index_by_key(
+		          page_tree,
+		          page,
+		          LIBESEDB_PAGE_FLAG_IS_LEAF,
+		          number_of_page_values,
+		          key,
+		          &page_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "page_value_index",
+		 page_value_index,
+		 expected_page_value_index );
+	}
+	binary_search_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                      start_time,
+	                      ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS );
+
+	fprintf(
+	 stdout,
+	 "page tree key lookup in %" PRIu16 " page values:\tlinear scan: %.0f ns\tbinary search: %.0f ns\n",
+	 number_of_page_values,
+	 linear_scan_time,
+	 binary_search_time );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Fills data with text made of a fixed set of words
+ * The text is stored as UTF-16 little-endian if is_utf16 is set, otherwise as ASCII
+ */
+void esedb_test_benchmark_set_text_data(
+      uint8_t *data,
+      size_t data_size,
+      uint8_t is_utf16 )
+{
+	const char *words[ 8 ] = {
+		"document ", "C:\\Users\\", "mailbox ", "search ", "item ", ".docx ", "folder ", "2020 " };
+
+	const char *word      = NULL;
+	size_t data_offset    = 0;
+	uint32_t random_value = 1;
+
+	while( data_offset < data_size )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		for( word = words[ ( random_value >> 16 ) % 8 ];
+		     *word != 0;
+		     word++ )
+		{
+			if( data_offset >= data_size )
+			{
+				break;
+			}
+			data[ data_offset++ ] = (uint8_t) *word;
+
+			if( ( is_utf16 != 0 )
+			 && ( data_offset < data_size ) )
+			{
+				data[ data_offset++ ] = 0;
+			}
+		}
+	}
+}
+
+/* Compresses ASCII data using 7-bit compression
+ * The data size must be a multiple of 8
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_7bit_compress(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *written_size )
+{
+	size_t compressed_data_offset = 0;
+	size_t data_offset            = 0;
+	uint32_t value_32bit          = 0;
+	uint8_t bit_count             = 0;
+
+	if( ( ( data_size % 8 ) != 0 )
+	 || ( ( 1 + ( ( data_size / 8 ) * 7 ) ) > compressed_data_size ) )
+	{
+		return( -1 );
+	}
+	compressed_data[ compressed_data_offset++ ] = 0x10;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		value_32bit |= (uint32_t) ( data[ data_offset ] & 0x7f ) << bit_count;
+		bit_count   += 7;
+
+		while( bit_count >= 8 )
+		{
+			compressed_data[ compressed_data_offset++ ] = (uint8_t) ( value_32bit & 0xff );
+
+			value_32bit >>= 8;
+			bit_count    -= 8;
+		}
+	}
+	*written_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZXPRESS (LZ77 + DIRECT2) compression
+ * The longest match within the preceding 256 bytes is used, which is slow
+ * but sufficient to generate benchmark data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_lzxpress_compress(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *written_size )
+{
+	size_t compressed_data_offset       = 0;
+	size_t compression_indicator_offset = 0;
+	size_t compression_nibble_offset    = 0;
+	size_t data_offset                  = 0;
+	size_t match_distance               = 0;
+	size_t match_size                   = 0;
+	size_t maximum_match_distance       = 0;
+	size_t tuple_distance               = 0;
+	size_t tuple_size                   = 0;
+	uint32_t compression_indicator      = 0;
+	uint8_t compression_indicator_bit   = 0;
+
+	if( compressed_data_size < 4 )
+	{
+		return( -1 );
+	}
+	compressed_data_offset = 4;
+
+	while( data_offset < data_size )
+	{
+		if( ( compressed_data_size - compressed_data_offset ) < 12 )
+		{
+			return( -1 );
+		}
+		if( compression_indicator_bit == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( compressed_data[ compression_indicator_offset ] ),
+			 compression_indicator );
+
+			compression_indicator_offset = compressed_data_offset;
+			compressed_data_offset      += 4;
+			compression_indicator        = 0;
+			compression_indicator_bit    = 0;
+		}
+		maximum_match_distance = data_offset;
+
+		if( maximum_match_distance > 256 )
+		{
+			maximum_match_distance = 256;
+		}
+		match_size = 0;
+
+		for( tuple_distance = 1;
+		     tuple_distance <= maximum_match_distance;
+		     tuple_distance++ )
+		{
+			for( tuple_size = 0;
+			     ( data_offset + tuple_size ) < data_size;
+			     tuple_size++ )
+			{
+				if( ( tuple_size >= 4096 )
+				 || ( data[ data_offset + tuple_size ] != data[ data_offset + tuple_size - tuple_distance ] ) )
+				{
+					break;
+				}
+			}
+			if( tuple_size > match_size )
+			{
+				match_distance = tuple_distance;
+				match_size     = tuple_size;
+			}
+		}
+		if( match_size < 3 )
+		{
+			compressed_data[ compressed_data_offset++ ] = data[ data_offset++ ];
+
+			compression_indicator_bit++;
+
+			continue;
+		}
+		compression_indicator |= 0x80000000UL >> compression_indicator_bit;
+
+		compression_indicator_bit++;
+
+		tuple_size = match_size - 3;
+
+		if( tuple_size < 7 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 (uint16_t) ( ( ( match_distance - 1 ) << 3 ) | tuple_size ) );
+
+			compressed_data_offset += 2;
+		}
+		else
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 (uint16_t) ( ( ( match_distance - 1 ) << 3 ) | 0x07 ) );
+
+			compressed_data_offset += 2;
+
+			tuple_size -= 7;
+
+			/* Two match sizes share the nibbles of a single byte
+			 */
+			if( compression_nibble_offset == 0 )
+			{
+				compression_nibble_offset = compressed_data_offset;
+
+				compressed_data[ compressed_data_offset++ ] = ( tuple_size < 15 ) ? (uint8_t) tuple_size : 0x0f;
+			}
+			else
+			{
+				compressed_data[ compression_nibble_offset ] |= ( ( tuple_size < 15 ) ? (uint8_t) tuple_size : 0x0f ) << 4;
+
+				compression_nibble_offset = 0;
+			}
+			if( tuple_size >= 15 )
+			{
+				tuple_size -= 15;
+
+				if( tuple_size < 255 )
+				{
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) tuple_size;
+				}
+				else
+				{
+					compressed_data[ compressed_data_offset++ ] = 0xff;
+
+					byte_stream_copy_from_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 (uint16_t) ( match_size - 3 ) );
+
+					compressed_data_offset += 2;
+				}
+			}
+		}
+		data_offset += match_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ compression_indicator_offset ] ),
+	 compression_indicator );
+
+	*written_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Checks if compressed data decompresses to specific data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_compression_verify(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *data,
+     size_t data_size )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	result = libesedb_compression_decompress_data(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 data_size );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          data,
+	          data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Benchmarks retrieving a compressed value as an UTF-8 string
+ * Size and copy decompresses the data in both libesedb_compression_get_utf8_string_size
+ * and libesedb_compression_copy_to_utf8_string, as a record value did before it kept
+ * the uncompressed data. Decompress once calls libesedb_compression_decompress_data
+ * and determines the size and copies the string from the uncompressed data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_compression_utf8_string(
+     const char *description,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_strings )
+{
+	uint8_t utf8_string[ 4096 ];
+
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	clock_t start_time            = 0;
+	double decompress_once_time   = 0.0;
+	double size_and_copy_time     = 0.0;
+	size_t uncompressed_data_size = 0;
+	size_t utf8_string_size       = 0;
+	int result                    = 0;
+	int string_index              = 0;
+
+	/* Benchmark size and copy
+	 */
+	start_time = clock();
+
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		result = libesedb_compression_get_utf8_string_size(
+		          compressed_data,
+		          compressed_data_size,
+		          &utf8_string_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( utf8_string_size > 4096 )
+		{
+			goto on_error;
+		}
+
+		result = libesedb_compression_copy_to_utf8_string(
+		          compressed_data,
+		          compressed_data_size,
+		          utf8_string,
+		          utf8_string_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	size_and_copy_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                      start_time,
+	                      number_of_strings );
+
+	/* Benchmark decompress once
+	 */
+	start_time = clock();
+
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		result = libesedb_compression_decompress_data(
+		          compressed_data,
+		          compressed_data_size,
+		          &uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libesedb_compression_get_utf8_string_size_from_uncompressed_data(
+		          compressed_data[ 0 ],
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &utf8_string_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( utf8_string_size > 4096 )
+		{
+			goto on_error;
+		}
+
+		result = libesedb_compression_copy_to_utf8_string_from_uncompressed_data(
+		          compressed_data[ 0 ],
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          utf8_string,
+		          utf8_string_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		memory_free(
+		 uncompressed_data );
+
+		uncompressed_data = NULL;
+	}
+	decompress_once_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                        start_time,
+	                        number_of_strings );
+
+	fprintf(
+	 stdout,
+	 "compressed string %s:\tsize and copy: %.0f ns\tdecompress once: %.0f ns\n",
+	 description,
+	 size_and_copy_time,
+	 decompress_once_time );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Benchmarks retrieving 7-bit and LZXPRESS compressed values as UTF-8 strings
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_compression(
+     void )
+{
+	uint8_t compressed_data[ 4096 ];
+	uint8_t data[ 2048 ];
+
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* 7-bit compressed ASCII text of 256 characters
+	 */
+	esedb_test_benchmark_set_text_data(
+	 data,
+	 256,
+	 0 );
+
+	result = esedb_test_benchmark_7bit_compress(
+	          data,
+	          256,
+	          compressed_data,
+	          4096,
+	          &compressed_data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( esedb_test_benchmark_compression_verify(
+	     compressed_data,
+	     compressed_data_size,
+	     data,
+	     256 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_benchmark_compression_utf8_string(
+	     "7-bit ASCII 256 characters",
+	     compressed_data,
+	     compressed_data_size,
+	     100000 ) != 1 )
+	{
+		goto on_error;
+	}
+	/* LZXPRESS compressed UTF-16 text of 1024 characters
+	 */
+	esedb_test_benchmark_set_text_data(
+	 data,
+	 2048,
+	 1 );
+
+	compressed_data[ 0 ] = 0x18;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 2048 );
+
+	result = esedb_test_benchmark_lzxpress_compress(
+	          data,
+	          2048,
+	          &( compressed_data[ 3 ] ),
+	          4096 - 3,
+	          &compressed_data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( esedb_test_benchmark_compression_verify(
+	     compressed_data,
+	     compressed_data_size + 3,
+	     data,
+	     2048 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_benchmark_compression_utf8_string(
+	     "LZXPRESS UTF-16 1024 characters",
+	     compressed_data,
+	     compressed_data_size + 3,
+	     100000 ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Benchmarks decompressing LZXPRESS compressed data
+ * The data is compressed with esedb_test_benchmark_lzxpress_compress
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_lzxpress_decompress(
+     const char *description,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_iterations )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *compressed_data      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	clock_t start_time            = 0;
+	double libesedb_throughput    = 0.0;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int iteration                 = 0;
+	int result                    = 0;
+
+#if defined( HAVE_LZXPRESS_FALLBACK )
+	double libfwnt_throughput     = 0.0;
+#endif
+
+	/* Initialize benchmark
+	 */
+	compressed_data = (uint8_t *) memory_allocate(
+	                               data_size + ( data_size / 8 ) + 16 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 data_size );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = esedb_test_benchmark_lzxpress_compress(
+	          data,
+	          data_size,
+	          compressed_data,
+	          data_size + ( data_size / 8 ) + 16,
+	          &compressed_data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	uncompressed_data_size = data_size;
+
+	result = libesedb_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 data_size );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          data,
+	          data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Benchmark libesedb_lzxpress_decompress
+	 */
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		uncompressed_data_size = data_size;
+
+		result = libesedb_lzxpress_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	libesedb_throughput = ( (double) data_size * 1000.0 ) / esedb_test_benchmark_get_nanoseconds_per_operation(
+	                                                         start_time,
+	                                                         number_of_iterations );
+
+#if defined( HAVE_LZXPRESS_FALLBACK )
+	/* Benchmark libfwnt_lzxpress_decompress
+	 */
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		uncompressed_data_size = data_size;
+
+		result = libfwnt_lzxpress_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	libfwnt_throughput = ( (double) data_size * 1000.0 ) / esedb_test_benchmark_get_nanoseconds_per_operation(
+	                                                        start_time,
+	                                                        number_of_iterations );
+
+	fprintf(
+	 stdout,
+	 "LZXPRESS decompression of %s (%" PRIzu " to %" PRIzu " bytes):\tlibesedb: %.0f MB/s\tlibfwnt: %.0f MB/s\n",
+	 description,
+	 compressed_data_size,
+	 data_size,
+	 libesedb_throughput,
+	 libfwnt_throughput );
+#else
+	fprintf(
+	 stdout,
+	 "LZXPRESS decompression of %s (%" PRIzu " to %" PRIzu " bytes):\tlibesedb: %.0f MB/s\n",
+	 description,
+	 compressed_data_size,
+	 data_size,
+	 libesedb_throughput );
+#endif
+	memory_free(
+	 uncompressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( 0 );
+}
+
+/* Benchmarks decompressing LZXPRESS compressed data of different composition
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_lzxpress(
+     void )
+{
+	uint8_t *data         = NULL;
+	size_t data_offset    = 0;
+	uint32_t random_value = 1;
+
+	data = (uint8_t *) memory_allocate(
+	                    65536 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Random bytes are mostly stored as literals
+	 */
+	for( data_offset = 0;
+	     data_offset < 65536;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	if( esedb_test_benchmark_lzxpress_decompress(
+	     "random bytes",
+	     data,
+	     65536,
+	     2000 ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Text is stored as a mix of literals and short matches
+	 */
+	esedb_test_benchmark_set_text_data(
+	 data,
+	 65536,
+	 1 );
+
+	if( esedb_test_benchmark_lzxpress_decompress(
+	     "UTF-16 text",
+	     data,
+	     65536,
+	     2000 ) != 1 )
+	{
+		goto on_error;
+	}
+	/* A repeated byte is stored as matches with a distance of 1
+	 */
+	if( memory_set(
+	     data,
+	     'a',
+	     65536 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( esedb_test_benchmark_lzxpress_decompress(
+	     "a repeated byte",
+	     data,
+	     65536,
+	     2000 ) != 1 )
+	{
+		goto on_error;
+	}
+	/* A repeated 3-byte sequence is stored as overlapping matches with a distance of 3
+	 */
+	for( data_offset = 0;
+	     data_offset < 65536;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 3 ) );
+	}
+	if( esedb_test_benchmark_lzxpress_decompress(
+	     "a repeated 3-byte sequence",
+	     data,
+	     65536,
+	     2000 ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Fills sidecar entries data with the catalog definitions of a specific number of tables
+ * The tables are named Table000000, Table000001, etc.
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_benchmark_set_catalog_entries_data(
+     uint8_t *entries_data,
+     size_t entries_data_size,
+     int number_of_tables )
+{
+	size_t entries_data_offset = 0;
+	int digit_index            = 0;
+	int table_index            = 0;
+	int table_number           = 0;
+
+	if( entries_data == NULL )
+	{
+		return( -1 );
+	}
+	if( ( number_of_tables <= 0 )
+	 || ( number_of_tables > 1000000 )
+	 || ( entries_data_size < ( (size_t) number_of_tables * 49 ) ) )
+	{
+		return( -1 );
+	}
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		if( memory_copy(
+		     &( entries_data[ entries_data_offset ] ),
+		     esedb_test_benchmark_catalog_entry_data,
+		     49 ) == NULL )
+		{
+			return( -1 );
+		}
+		table_number = table_index;
+
+		for( digit_index = 48;
+		     digit_index >= 43;
+		     digit_index-- )
+		{
+			entries_data[ entries_data_offset + digit_index ] = (uint8_t) ( '0' + ( table_number % 10 ) );
+
+			table_number /= 10;
+		}
+		entries_data_offset += 49;
+	}
+	return( 1 );
+}
+
+/* Benchmarks libesedb_catalog_get_table_definition_by_name without and with the name hash table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_benchmark_catalog_get_table_definition_by_name(
+     int number_of_tables )
+{
+	uint8_t table_name[ 12 ] = {
+		'T', 'a', 'b', 'l', 'e', '0', '0', '0', '0', '0', '0', 0 };
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	uint8_t *entries_data                         = NULL;
+	clock_t start_time                            = 0;
+	double hash_table_time                        = 0.0;
+	double linear_compare_time                    = 0.0;
+	int digit_index                               = 0;
+	int lookup_index                              = 0;
+	int result                                    = 0;
+	int table_number                              = 0;
+
+	/* Initialize benchmark
+	 */
+	entries_data = (uint8_t *) memory_allocate(
+	                            (size_t) number_of_tables * 49 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "entries_data",
+	 entries_data );
+
+	result = esedb_test_benchmark_set_catalog_entries_data(
+	          entries_data,
+	          (size_t) number_of_tables * 49,
+	          number_of_tables );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = ESEDB_TEST_BENCHMARK_PAGE_SIZE;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_catalog_read_values_from_sidecar(
+	          catalog,
+	          entries_data,
+	          (size_t) number_of_tables * 49,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Benchmark the lookups without the name hash table, which compare the name
+	 * with every table definition
+	 */
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		table_number = lookup_index % number_of_tables;
+
+		for( digit_index = 10;
+		     digit_index >= 5;
+		     digit_index-- )
+		{
+			table_name[ digit_index ] = (uint8_t) ( '0' + ( table_number % 10 ) );
+
+			table_number /= 10;
+		}
+		result = libesedb_catalog_get_table_definition_by_name(
+		          catalog,
+		          table_name,
+		          11,
+		          &table_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	linear_compare_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                       start_time,
+	                       ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS );
+
+	result = libesedb_catalog_build_name_hash_table(
+	          catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Benchmark the lookups with the name hash table
+	 */
+	start_time = clock();
+
+	for( lookup_index = 0;
+	     lookup_index < ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS;
+	     lookup_index++ )
+	{
+		table_number = lookup_index % number_of_tables;
+
+		for( digit_index = 10;
+		     digit_index >= 5;
+		     digit_index-- )
+		{
+			table_name[ digit_index ] = (uint8_t) ( '0' + ( table_number % 10 ) );
+
+			table_number /= 10;
+		}
+		result = libesedb_catalog_get_table_definition_by_name(
+		          catalog,
+		          table_name,
+		          11,
+		          &table_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	hash_table_time = esedb_test_benchmark_get_nanoseconds_per_operation(
+	                   start_time,
+	                   ESEDB_TEST_BENCHMARK_NUMBER_OF_LOOKUPS );
+
+	fprintf(
+	 stdout,
+	 "catalog table lookup by name in %d tables:\tlinear compare: %.0f ns\tname hash table: %.0f ns\n",
+	 number_of_tables,
+	 linear_compare_time,
+	 hash_table_time );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 entries_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	uint16_t number_of_page_values = 0;
+	int number_of_tables           = 0;
+#endif
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	for( number_of_page_values = 16;
+	     number_of_page_values <= 256;
+	     number_of_page_values *= 4 )
+	{
+		if( esedb_test_benchmark_page_tree_get_first_page_value_index_by_key(
+		     number_of_page_values ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( esedb_test_benchmark_compression() != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_benchmark_lzxpress() != 1 )
+	{
+		goto on_error;
+	}
+	for( number_of_tables = 16;
+	     number_of_tables <= 1024;
+	     number_of_tables *= 4 )
+	{
+		if( esedb_test_benchmark_catalog_get_table_definition_by_name(
+		     number_of_tables ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -39,6 +39,24 @@
 #include "../libesedb/libesedb_catalog.h"
 #include "../libesedb/libesedb_io_handle.h"
 
+/* A sidecar with a single entry that contains the MSysObjects table catalog definition
+ */
+uint8_t esedb_test_catalog_sidecar_data1[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00,
+	0x00, 0x00, 0xff, 0x00, 0x0b, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+	0x73 };
+
+/* A sidecar with an entry size that exceeds the sidecar data
+ */
+uint8_t esedb_test_catalog_sidecar_data2[ 8 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x08, 0x80, 0x20, 0x00 };
+
+/* A sidecar with a truncated entry size
+ */
+uint8_t esedb_test_catalog_sidecar_data3[ 2 ] = {
+	0x2d, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_catalog_initialize function
@@ -249,24 +267,607 @@ int esedb_test_catalog_initialize(
 			 result,
 			 -1 );
 
-			ESEDB_TEST_ASSERT_IS_NULL(
-			 "catalog",
-			 catalog );
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog",
+			 catalog );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_values_from_sidecar function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_values_from_sidecar(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int number_of_table_definitions               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_read_values_from_sidecar(
+	          catalog,
+	          esedb_test_catalog_sidecar_data1,
+	          49,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_values_from_sidecar(
+	          NULL,
+	          esedb_test_catalog_sidecar_data1,
+	          49,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an entry size that exceeds the sidecar data
+	 */
+	table_definition = NULL;
+
+	result = libesedb_catalog_read_values_from_sidecar(
+	          catalog,
+	          esedb_test_catalog_sidecar_data2,
+	          8,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated entry size
+	 */
+	table_definition = NULL;
+
+	result = libesedb_catalog_read_values_from_sidecar(
+	          catalog,
+	          esedb_test_catalog_sidecar_data3,
+	          2,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The malformed sidecar data should not have added table definitions
+	 */
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_table_definitions",
+	 number_of_table_definitions,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_file_io_handle(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_catalog_t *catalog      = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+/* TODO implement */
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_get_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_get_name_hash(
+     void )
+{
+	uint8_t name[ 5 ]             = { 't', 'e', 's', 't', 0 };
+	uint8_t non_ascii_name[ 4 ]   = { 't', 0xe9, 's', 't' };
+	uint8_t other_name[ 4 ]       = { 't', 'e', 'x', 't' };
+	libcerror_error_t *error      = NULL;
+	uint32_t name_hash            = 0;
+	uint32_t other_name_hash      = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_get_name_hash(
+	          name,
+	          4,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0xafd071e5UL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the end-of-string character is not part of the hash
+	 */
+	result = libesedb_catalog_get_name_hash(
+	          name,
+	          5,
+	          &other_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "other_name_hash",
+	 other_name_hash,
+	 name_hash );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_name_hash(
+	          other_name,
+	          4,
+	          &other_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			ESEDB_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "other_name_hash",
+	 other_name_hash,
+	 (uint32_t) 0xbde64e3eUL );
 
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
-	result = libesedb_io_handle_free(
-	          &io_handle,
+	result = libesedb_catalog_get_name_hash(
+	          non_ascii_name,
+	          4,
+	          &other_name_hash,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -274,14 +875,71 @@ int esedb_test_catalog_initialize(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "other_name_hash",
+	 other_name_hash,
+	 (uint32_t) 0 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libesedb_catalog_get_name_hash(
+	          NULL,
+	          4,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_get_name_hash(
+	          name,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_get_name_hash(
+	          name,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -290,33 +948,121 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( catalog != NULL )
-	{
-		libesedb_catalog_free(
-		 &catalog,
-		 NULL );
-	}
-	if( io_handle != NULL )
-	{
-		libesedb_io_handle_free(
-		 &io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libesedb_catalog_free function
+/* Tests the libesedb_catalog_get_utf16_name_hash function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_catalog_free(
+int esedb_test_catalog_get_utf16_name_hash(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint16_t utf16_name[ 5 ]      = { 't', 'e', 's', 't', 0 };
+	uint16_t non_ascii_name[ 4 ]  = { 't', 0x00e9, 's', 't' };
+	uint8_t name[ 4 ]             = { 't', 'e', 's', 't' };
+	libcerror_error_t *error      = NULL;
+	uint32_t name_hash            = 0;
+	uint32_t utf16_name_hash      = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_get_name_hash(
+	          name,
+	          4,
+	          &name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_utf16_name_hash(
+	          utf16_name,
+	          5,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_name_hash",
+	 utf16_name_hash,
+	 name_hash );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_utf16_name_hash(
+	          non_ascii_name,
+	          4,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_name_hash",
+	 utf16_name_hash,
+	 (uint32_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_catalog_free(
+	result = libesedb_catalog_get_utf16_name_hash(
+	          NULL,
+	          4,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_get_utf16_name_hash(
+	          utf16_name,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf16_name_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_get_utf16_name_hash(
+	          utf16_name,
+	          4,
 	          NULL,
 	          &error );
 
@@ -343,19 +1089,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_catalog_read_file_io_handle function
+/* Tests the libesedb_catalog_build_name_hash_table function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_catalog_read_file_io_handle(
+int esedb_test_catalog_build_name_hash_table(
      void )
 {
-	uint8_t data[ 4096 ];
-
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libesedb_catalog_t *catalog      = NULL;
-	libesedb_io_handle_t *io_handle  = NULL;
-	int result                       = 0;
+	libcerror_error_t *error                            = NULL;
+	libesedb_catalog_t *catalog                         = NULL;
+	libesedb_io_handle_t *io_handle                     = NULL;
+	libesedb_table_definition_t *table_definition       = NULL;
+	libesedb_table_definition_t *found_table_definition = NULL;
+	int result                                          = 0;
 
 	/* Initialize test
 	 */
@@ -400,12 +1145,11 @@ int esedb_test_catalog_read_file_io_handle(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
-	 */
-	result = esedb_test_open_file_io_handle(
-	          &file_io_handle,
-	          data,
-	          4096,
+	result = libesedb_catalog_read_values_from_sidecar(
+	          catalog,
+	          esedb_test_catalog_sidecar_data1,
+	          49,
+	          &table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -414,8 +1158,8 @@ int esedb_test_catalog_read_file_io_handle(
 	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	 "table_definition",
+	 table_definition );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -423,31 +1167,60 @@ int esedb_test_catalog_read_file_io_handle(
 
 	/* Test regular cases
 	 */
-/* TODO implement */
+	result = libesedb_catalog_build_name_hash_table(
+	          catalog,
+	          &error );
 
-	/* Test error cases
-	 */
-	result = libesedb_catalog_read_file_io_handle(
-	          NULL,
-	          file_io_handle,
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog->name_hash_buckets",
+	 catalog->name_hash_buckets );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "catalog->number_of_name_hash_entries",
+	 catalog->number_of_name_hash_entries,
+	 1 );
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MSysObjects",
+	          11,
+	          &found_table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "found_table_definition",
+	 found_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "found_table_definition",
+	 (intptr_t) found_table_definition,
+	 (intptr_t) table_definition );
 
-	/* Clean up file IO handle
-	 */
-	result = esedb_test_close_file_io_handle(
-	          &file_io_handle,
+	found_table_definition = NULL;
+
+	result = libesedb_catalog_get_table_definition_by_name(
+	          catalog,
+	          (uint8_t *) "MSysObject",
+	          10,
+	          &found_table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -459,6 +1232,24 @@ int esedb_test_catalog_read_file_io_handle(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libesedb_catalog_build_name_hash_table(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libesedb_catalog_free(
@@ -503,12 +1294,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	if( catalog != NULL )
 	{
 		libesedb_catalog_free(
@@ -1134,10 +1919,32 @@ int main(
 
 /* TODO add test for libesedb_catalog_read_values_from_page */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_values_from_sidecar",
+	 esedb_test_catalog_read_values_from_sidecar );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_catalog_read_file_io_handle",
 	 esedb_test_catalog_read_file_io_handle );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_get_name_hash",
+	 esedb_test_catalog_get_name_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_get_utf16_name_hash",
+	 esedb_test_catalog_get_utf16_name_hash );
+
+/* TODO add test for libesedb_catalog_free_name_hash_table */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_build_name_hash_table",
+	 esedb_test_catalog_build_name_hash_table );
+
+/* TODO add test for libesedb_catalog_get_first_name_hash_entry_index */
+
+/* TODO add test for libesedb_catalog_get_next_name_hash_entry_index */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -1643,6 +1643,10 @@ int main(
 	 esedb_test_catalog_definition_get_column_type,
 	 catalog_definition );
 
+	/* TODO: add tests for libesedb_catalog_definition_get_number_of_key_columns */
+
+	/* TODO: add tests for libesedb_catalog_definition_get_key_column */
+
 	ESEDB_TEST_RUN_WITH_ARGS(
 	 "libesedb_catalog_definition_get_utf8_name_size",
 	 esedb_test_catalog_definition_get_utf8_name_size,
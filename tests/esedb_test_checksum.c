@@ -1065,6 +1065,114 @@ uint8_t esedb_test_checksum_page_0x620_0x0c_data[ 8192 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Calculates the parity of a 32-bit value
+ * Returns 1 if the number of bits set is odd or 0 if even
+ */
+uint8_t esedb_test_checksum_parity32(
+         uint32_t value_32bit )
+{
+	uint8_t parity = 0;
+
+	while( value_32bit != 0 )
+	{
+		parity      ^= 1;
+		value_32bit &= value_32bit - 1;
+	}
+	return( parity );
+}
+
+/* Calculates the little-endian ECC-32 and XOR-32 of a buffer one 32-bit value at a time
+ * Reference implementation used to cross-check libesedb_checksum_calculate_little_endian_ecc32
+ */
+void esedb_test_checksum_reference_calculate_little_endian_ecc32(
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor_checksum_value,
+      const uint8_t *buffer,
+      size_t size,
+      size_t offset,
+      uint32_t initial_value )
+{
+	uint32_t vertical_xor32[ 4 ] = { 0, 0, 0, 0 };
+
+	size_t buffer_offset         = 0;
+	uint32_t bitmask             = 0xff800000UL;
+	uint32_t bit_iterator        = 0;
+	uint32_t final_bitmask       = 0;
+	uint32_t value_32bit         = 0;
+	uint32_t xor32_value         = 0;
+	uint8_t vertical_index       = 0;
+
+	*ecc_checksum_value = 0;
+
+	vertical_index = (uint8_t) ( ( offset % 16 ) / 4 );
+
+	for( buffer_offset = offset;
+	     buffer_offset < size;
+	     buffer_offset += 4 )
+	{
+		value_32bit = (uint32_t) buffer[ buffer_offset ]
+		            | ( (uint32_t) buffer[ buffer_offset + 1 ] << 8 )
+		            | ( (uint32_t) buffer[ buffer_offset + 2 ] << 16 )
+		            | ( (uint32_t) buffer[ buffer_offset + 3 ] << 24 );
+
+		vertical_xor32[ vertical_index ] ^= value_32bit;
+		xor32_value                      ^= value_32bit;
+
+		vertical_index += 1;
+
+		if( vertical_index == 4 )
+		{
+			if( esedb_test_checksum_parity32( xor32_value ) != 0 )
+			{
+				*ecc_checksum_value ^= bitmask;
+			}
+			bitmask       -= 0x007fff80UL;
+			vertical_index = 0;
+			xor32_value    = 0;
+		}
+	}
+	if( esedb_test_checksum_parity32( xor32_value ) != 0 )
+	{
+		*ecc_checksum_value ^= bitmask;
+	}
+	if( esedb_test_checksum_parity32( vertical_xor32[ 0 ] ^ vertical_xor32[ 1 ] ) != 0 )
+	{
+		*ecc_checksum_value ^= 0x00400000UL;
+	}
+	if( esedb_test_checksum_parity32( vertical_xor32[ 0 ] ^ vertical_xor32[ 2 ] ) != 0 )
+	{
+		*ecc_checksum_value ^= 0x00200000UL;
+	}
+	if( esedb_test_checksum_parity32( vertical_xor32[ 1 ] ^ vertical_xor32[ 3 ] ) != 0 )
+	{
+		*ecc_checksum_value ^= 0x00000020UL;
+	}
+	if( esedb_test_checksum_parity32( vertical_xor32[ 2 ] ^ vertical_xor32[ 3 ] ) != 0 )
+	{
+		*ecc_checksum_value ^= 0x00000040UL;
+	}
+	xor32_value = vertical_xor32[ 0 ] ^ vertical_xor32[ 1 ] ^ vertical_xor32[ 2 ] ^ vertical_xor32[ 3 ];
+
+	bitmask = 0xffff0000UL;
+
+	for( bit_iterator = 1;
+	     bit_iterator != 0;
+	     bit_iterator <<= 1 )
+	{
+		if( ( xor32_value & bit_iterator ) != 0 )
+		{
+			final_bitmask ^= bitmask;
+		}
+		bitmask -= 0x0000ffffUL;
+	}
+	if( size < 8192 )
+	{
+		*ecc_checksum_value &= 0xffffffffUL ^ (uint32_t) ( size << 19 );
+	}
+	*ecc_checksum_value ^= ( *ecc_checksum_value ^ final_bitmask ) & 0x001f001fUL;
+	*xor_checksum_value  = initial_value ^ xor32_value;
+}
+
 /* Tests the libesedb_checksum_calculate_little_endian_ecc32 function
  * Returns 1 if successful or 0 if not
  */
@@ -1226,6 +1334,93 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_checksum_calculate_little_endian_ecc32 function against the reference implementation
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_checksum_calculate_little_endian_ecc32_with_reference(
+     void )
+{
+	size_t test_sizes[ 6 ] = { 8192, 4096, 4100, 1024, 36, 16 };
+
+	uint8_t *test_pages[ 2 ] = {
+		esedb_test_checksum_page_0x620_0x09_data,
+		esedb_test_checksum_page_0x620_0x0c_data };
+
+	libcerror_error_t *error              = NULL;
+	size_t offset                         = 0;
+	uint32_t ecc_checksum_value           = 0;
+	uint32_t reference_ecc_checksum_value = 0;
+	uint32_t reference_xor_checksum_value = 0;
+	uint32_t xor_checksum_value           = 0;
+	int page_index                        = 0;
+	int result                            = 0;
+	int size_index                        = 0;
+
+	for( page_index = 0;
+	     page_index < 2;
+	     page_index++ )
+	{
+		for( size_index = 0;
+		     size_index < 6;
+		     size_index++ )
+		{
+			for( offset = 0;
+			     offset <= 32;
+			     offset += 4 )
+			{
+				if( offset > test_sizes[ size_index ] )
+				{
+					break;
+				}
+				esedb_test_checksum_reference_calculate_little_endian_ecc32(
+				 &reference_ecc_checksum_value,
+				 &reference_xor_checksum_value,
+				 test_pages[ page_index ],
+				 test_sizes[ size_index ],
+				 offset,
+				 (uint32_t) page_index );
+
+				result = libesedb_checksum_calculate_little_endian_ecc32(
+				          &ecc_checksum_value,
+				          &xor_checksum_value,
+				          test_pages[ page_index ],
+				          test_sizes[ size_index ],
+				          offset,
+				          (uint32_t) page_index,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_EQUAL_UINT32(
+				 "ecc_checksum_value",
+				 ecc_checksum_value,
+				 reference_ecc_checksum_value );
+
+				ESEDB_TEST_ASSERT_EQUAL_UINT32(
+				 "xor_checksum_value",
+				 xor_checksum_value,
+				 reference_xor_checksum_value );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_checksum_calculate_little_endian_xor32 function
  * Returns 1 if successful or 0 if not
  */
@@ -1368,6 +1563,10 @@ int main(
 	 "libesedb_checksum_calculate_little_endian_ecc32",
 	 esedb_test_checksum_calculate_little_endian_ecc32 );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_checksum_calculate_little_endian_ecc32_with_reference",
+	 esedb_test_checksum_calculate_little_endian_ecc32_with_reference );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_checksum_calculate_little_endian_xor32",
 	 esedb_test_checksum_calculate_little_endian_xor32 );
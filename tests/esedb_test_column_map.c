@@ -0,0 +1,991 @@
+/*
+ * Library column_map type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_column_map.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Appends a column catalog definition to a table definition
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_column_map_append_column(
+     libesedb_table_definition_t *table_definition,
+     uint32_t column_identifier,
+     const char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+
+	if( libesedb_catalog_definition_initialize(
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->type       = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+	column_catalog_definition->identifier = column_identifier;
+
+	column_catalog_definition->name = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * name_size );
+
+	if( column_catalog_definition->name == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     column_catalog_definition->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		goto on_error;
+	}
+	column_catalog_definition->name_size = name_size;
+
+	if( libesedb_table_definition_append_column_catalog_definition(
+	     table_definition,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_column_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_column_map_initialize(
+     libesedb_table_definition_t *table_definition )
+{
+	libesedb_table_definition_t empty_table_definition;
+
+	libcerror_error_t *error          = NULL;
+	libesedb_column_map_t *column_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 4;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test column_map initialization
+	 */
+	result = libesedb_column_map_initialize(
+	          &column_map,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_map",
+	 column_map );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "column_map->number_of_entries",
+	 column_map->number_of_entries,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_map_free(
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column_map",
+	 column_map );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_column_map_initialize(
+	          NULL,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column_map = (libesedb_column_map_t *) 0x12345678UL;
+
+	result = libesedb_column_map_initialize(
+	          &column_map,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	column_map = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_initialize(
+	          &column_map,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a table definition without a column catalog definition array
+	 */
+	memory_set(
+	 &empty_table_definition,
+	 0,
+	 sizeof( libesedb_table_definition_t ) );
+
+	result = libesedb_column_map_initialize(
+	          &column_map,
+	          &empty_table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_column_map_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_column_map_initialize(
+		          &column_map,
+		          table_definition,
+		          NULL,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( column_map != NULL )
+			{
+				libesedb_column_map_free(
+				 &column_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "column_map",
+			 column_map );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_column_map_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_column_map_initialize(
+		          &column_map,
+		          table_definition,
+		          NULL,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( column_map != NULL )
+			{
+				libesedb_column_map_free(
+				 &column_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "column_map",
+			 column_map );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_map != NULL )
+	{
+		libesedb_column_map_free(
+		 &column_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_column_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_column_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_column_map_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_column_map_get_value_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_column_map_get_value_entry_by_identifier(
+     libesedb_column_map_t *column_map )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_entry          = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          column_map,
+	          256,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          column_map,
+	          2,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          NULL,
+	          256,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_identifier(
+	          column_map,
+	          256,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_column_map_get_value_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_column_map_get_value_entry_by_utf8_name(
+     libesedb_column_map_t *column_map )
+{
+	uint8_t utf8_name[ 3 ]   = { 'I', 'd', 0 };
+	uint8_t utf8_other[ 4 ]  = { 'K', 'e', 'y', 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_entry          = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          column_map,
+	          utf8_name,
+	          2,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          column_map,
+	          utf8_other,
+	          3,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          NULL,
+	          utf8_name,
+	          2,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          column_map,
+	          NULL,
+	          2,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          column_map,
+	          utf8_name,
+	          (size_t) SSIZE_MAX + 1,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf8_name(
+	          column_map,
+	          utf8_name,
+	          2,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_column_map_get_value_entry_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_column_map_get_value_entry_by_utf16_name(
+     libesedb_column_map_t *column_map )
+{
+	uint16_t utf16_name[ 5 ]  = { 'N', 'a', 'm', 'e', 0 };
+	uint16_t utf16_other[ 4 ] = { 'K', 'e', 'y', 0 };
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+	int value_entry           = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          column_map,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_entry",
+	 value_entry,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          column_map,
+	          utf16_other,
+	          3,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          column_map,
+	          NULL,
+	          4,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          column_map,
+	          utf16_name,
+	          (size_t) SSIZE_MAX + 1,
+	          &value_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_column_map_get_value_entry_by_utf16_name(
+	          column_map,
+	          utf16_name,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	libcerror_error_t *error                               = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_column_map_t *column_map                      = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	int result                                             = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = esedb_test_column_map_append_column(
+	          table_definition,
+	          1,
+	          "Id",
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_column_map_append_column(
+	          table_definition,
+	          256,
+	          "Name",
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_column_map_initialize",
+	 esedb_test_column_map_initialize,
+	 table_definition );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_column_map_free",
+	 esedb_test_column_map_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	result = libesedb_column_map_initialize(
+	          &column_map,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_map",
+	 column_map );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_column_map_get_value_entry_by_identifier",
+	 esedb_test_column_map_get_value_entry_by_identifier,
+	 column_map );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_column_map_get_value_entry_by_utf8_name",
+	 esedb_test_column_map_get_value_entry_by_utf8_name,
+	 column_map );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_column_map_get_value_entry_by_utf16_name",
+	 esedb_test_column_map_get_value_entry_by_utf16_name,
+	 column_map );
+
+	/* Clean up
+	 */
+	result = libesedb_column_map_free(
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column_map",
+	 column_map );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_map != NULL )
+	{
+		libesedb_column_map_free(
+		 &column_map,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -64,6 +64,13 @@ uint16_t esedb_test_compression_7bit_uncompressed_utf16_string[ 56 ] = {
 	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x29, 0x00
 };
 
+/* The sequence: The quick brown fox compressed in 7-bit
+ * including leading byte 0x10, where the last block is incomplete
+ */
+uint8_t esedb_test_compression_7bit_compressed_data_with_remainder[ 18 ] = {
+	0x10, 0x54, 0x74, 0x19, 0x14, 0xaf, 0xa7, 0xc7, 0x6b, 0x90, 0x58, 0xfe, 0xbe, 0xbb, 0x41, 0xe6,
+	0x37, 0x1e };
+
 /* The sequence: abcdefghijklmnopqrstuvwxyz compressed in LZXpress
  * including leading byte 0x18 and uncompressed data size 0x001a
  */
@@ -248,6 +255,32 @@ int esedb_test_compression_7bit_decompress(
 	 result,
 	 0 );
 
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data_with_remainder,
+	          18,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "The quick brown fox",
+	          19 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = libesedb_compression_7bit_decompress(
@@ -891,6 +924,174 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_compression_decompress_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_decompress_data(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_decompress_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	result = libesedb_compression_decompress_data(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_decompress_data(
+	          NULL,
+	          50,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_decompress_data(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_compression_get_utf8_string_size function
  * Returns 1 if successful or 0 if not
  */
@@ -1432,6 +1633,10 @@ int main(
 	 "libesedb_compression_decompress",
 	 esedb_test_compression_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_decompress_data",
+	 esedb_test_compression_decompress_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_get_utf8_string_size",
 	 esedb_test_compression_get_utf8_string_size );
@@ -1448,6 +1653,14 @@ int main(
 	 "libesedb_compression_copy_to_utf16_string",
 	 esedb_test_compression_copy_to_utf16_string );
 
+	/* TODO: add tests for libesedb_compression_get_utf8_string_size_from_uncompressed_data */
+
+	/* TODO: add tests for libesedb_compression_copy_to_utf8_string_from_uncompressed_data */
+
+	/* TODO: add tests for libesedb_compression_get_utf16_string_size_from_uncompressed_data */
+
+	/* TODO: add tests for libesedb_compression_copy_to_utf16_string_from_uncompressed_data */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -335,6 +336,526 @@ int esedb_test_data_definition_read_record(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_get_record_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_record_value(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_record_value(
+	          NULL,
+	          0,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data definition without record data
+	 */
+	result = libesedb_data_definition_get_record_value(
+	          data_definition,
+	          0,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_get_record_value_data_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_record_value_data_reference(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	const uint8_t *value_data                   = NULL;
+	void *memset_result                         = NULL;
+	size_t value_data_size                      = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data definition without record data
+	 */
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_definition->record_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * 8 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition->record_data",
+	 data_definition->record_data );
+
+	data_definition->record_data_size = 8;
+
+	data_definition->value_descriptors = (libesedb_record_value_descriptor_t *) memory_allocate(
+	                                                                              sizeof( libesedb_record_value_descriptor_t ) * 3 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition->value_descriptors",
+	 data_definition->value_descriptors );
+
+	memset_result = memory_set(
+	                 data_definition->value_descriptors,
+	                 0,
+	                 sizeof( libesedb_record_value_descriptor_t ) * 3 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	data_definition->number_of_value_descriptors = 3;
+
+	data_definition->value_descriptors[ 0 ].data_offset = 2;
+	data_definition->value_descriptors[ 0 ].data_size   = 4;
+	data_definition->value_descriptors[ 0 ].has_data    = 1;
+
+	data_definition->value_descriptors[ 2 ].data_offset = 6;
+	data_definition->value_descriptors[ 2 ].data_size   = 4;
+	data_definition->value_descriptors[ 2 ].has_data    = 1;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "value_data",
+	 (intptr_t) value_data,
+	 (intptr_t) &( data_definition->record_data[ 2 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test value without data
+	 */
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "value_data",
+	 value_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          NULL,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          -1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          3,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          0,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          0,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test value descriptor with data out of bounds
+	 */
+	result = libesedb_data_definition_get_record_value_data_reference(
+	          data_definition,
+	          2,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_read_fixed_size_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_read_fixed_size_value_data(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	const uint8_t *value_data                   = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_read_fixed_size_value_data(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          4,
+	          8,
+	          &value_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_read_fixed_size_value_data(
+	          data_definition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          4,
+	          8,
+	          &value_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_read_fixed_size_value_data(
+	          data_definition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          128,
+	          4,
+	          8,
+	          &value_data,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -349,6 +870,49 @@ int esedb_test_data_definition_read_record(
 	libcerror_error_free(
 	 &error );
 
+	result = libesedb_data_definition_read_fixed_size_value_data(
+	          data_definition,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          4,
+	          8,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -357,6 +921,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -376,6 +946,7 @@ int esedb_test_data_definition_read_long_value(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -480,6 +1051,18 @@ int main(
 	 "libesedb_data_definition_read_record",
 	 esedb_test_data_definition_read_record );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_record_value",
+	 esedb_test_data_definition_get_record_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_record_value_data_reference",
+	 esedb_test_data_definition_get_record_value_data_reference );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_read_fixed_size_value_data",
+	 esedb_test_data_definition_read_fixed_size_value_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_data_definition_read_long_value",
 	 esedb_test_data_definition_read_long_value );
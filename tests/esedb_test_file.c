@@ -432,6 +432,7 @@ int esedb_test_file_open(
 
 	libcerror_error_t *error = NULL;
 	libesedb_file_t *file    = NULL;
+	int number_of_tables     = 0;
 	int result               = 0;
 
 	/* Initialize test
@@ -561,6 +562,70 @@ int esedb_test_file_open(
 	libcerror_error_free(
 	 &error );
 
+	/* Test open memory mapped
+	 */
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_open(
+	          file,
+	          narrow_source,
+	          LIBESEDB_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open memory mapped when already opened
+	 */
+	result = libesedb_file_open(
+	          file,
+	          narrow_source,
+	          LIBESEDB_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libesedb_file_free(
@@ -1180,6 +1245,81 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_file_write_sidecar function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_write_sidecar(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_file_write_sidecar(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file without a sidecar filename
+	 */
+	result = libesedb_file_write_sidecar(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file that is already open
+	 */
+	result = libesedb_file_set_sidecar_filename(
+	          file,
+	          "sidecar",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
@@ -1379,6 +1519,261 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_file_set_page_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_set_page_cache_size(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_set_page_cache_size(
+	          file,
+	          1024 * 1024,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size smaller than a single page
+	 */
+	result = libesedb_file_set_page_cache_size(
+	          file,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Restore the default size
+	 */
+	result = libesedb_file_set_page_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_set_page_cache_size(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_page_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_page_cache_statistics(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t number_of_hits   = 0;
+	uint64_t number_of_misses = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_page_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_page_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_cache_statistics(
+	          file,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_verify_page_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_verify_page_checksums(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error            = NULL;
+	uint32_t number_of_mismatched_pages = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_verify_page_checksums(
+	          file,
+	          &number_of_mismatched_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_verify_page_checksums(
+	          NULL,
+	          &number_of_mismatched_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_verify_page_checksums(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_file_get_number_of_tables function
  * Returns 1 if successful or 0 if not
  */
@@ -1622,10 +2017,23 @@ int main(
 		 esedb_test_file_signal_abort,
 		 file );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_write_sidecar",
+		 esedb_test_file_write_sidecar,
+		 file );
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 		/* TODO: add tests for libesedb_file_open_read */
 
+		/* TODO: add tests for libesedb_file_read_sidecar */
+
+		/* TODO: add tests for libesedb_file_append_page_tree_to_sidecar */
+
+		/* TODO: add tests for libesedb_file_append_page_trees_to_sidecar */
+
+		/* TODO: add tests for libesedb_file_get_maximum_number_of_pages_cache_entries */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 		ESEDB_TEST_RUN_WITH_ARGS(
@@ -1642,6 +2050,21 @@ int main(
 		 esedb_test_file_get_page_size,
 		 file );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_set_page_cache_size",
+		 esedb_test_file_set_page_cache_size,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_page_cache_statistics",
+		 esedb_test_file_get_page_cache_statistics,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_verify_page_checksums",
+		 esedb_test_file_verify_page_checksums,
+		 file );
+
 		ESEDB_TEST_RUN_WITH_ARGS(
 		 "libesedb_file_get_number_of_tables",
 		 esedb_test_file_get_number_of_tables,
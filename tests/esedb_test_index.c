@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,11 +30,82 @@
 
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_index_cursor.h"
+#include "../libesedb/libesedb_index_key.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_memory_map.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The index page tree consists of a root branch page (page 1) and 2 leaf pages
+ * Leaf page 2 contains the keys: 0x01 0x01, 0x02 0x01 and 0x02 0x02
+ * Leaf page 3 contains the keys: 0x02 0x03 and 0x03 0x01
+ * The keys 0x02 0x01, 0x02 0x02 and 0x02 0x03 are stored with a common key
+ * The index entries reference the records with bookmarks: 3, 1, 3, 2 and 5
+ */
+uint8_t esedb_test_index_page1_data[ 70 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xae, 0x0f, 0x00, 0x00,
+	0x1e, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_page1_tags[ 12 ] = {
+	0x06, 0x00, 0x18, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_page2_data[ 67 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xad, 0x0f, 0x00, 0x00,
+	0x1b, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x7f, 0x80, 0x00,
+	0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x7f, 0x80, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x02, 0x7f,
+	0x80, 0x00, 0x03 };
+
+uint8_t esedb_test_index_page2_tags[ 16 ] = {
+	0x09, 0x00, 0x12, 0x80, 0x09, 0x00, 0x09, 0x80, 0x08, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_page3_data[ 58 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xba, 0x0f, 0x00, 0x00,
+	0x12, 0x00, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x03, 0x7f, 0x80,
+	0x00, 0x02, 0x02, 0x00, 0x03, 0x01, 0x7f, 0x80, 0x00, 0x05 };
+
+uint8_t esedb_test_index_page3_tags[ 12 ] = {
+	0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00 };
+
+/* The table page tree consists of a root leaf page (page 4)
+ * that contains the records with bookmarks: 1, 2 and 3
+ * The last byte of the record data contains the bookmark
+ */
+uint8_t esedb_test_index_page4_data[ 89 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x97, 0x0f, 0x00, 0x00,
+	0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7f, 0x80, 0x00, 0x01, 0x00, 0x7f,
+	0x04, 0x00, 0x01, 0x04, 0x00, 0x7f, 0x80, 0x00, 0x02, 0x00, 0x7f, 0x04, 0x00, 0x02, 0x04, 0x00,
+	0x7f, 0x80, 0x00, 0x03, 0x00, 0x7f, 0x04, 0x00, 0x03 };
+
+uint8_t esedb_test_index_page4_tags[ 16 ] = {
+	0x0b, 0x00, 0x26, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00 };
+
+/* The file data consists of the 2 file header pages followed by the index and table pages
+ */
+uint8_t esedb_test_index_file_data[ 6 * 4096 ];
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
@@ -73,8 +145,1758 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Reads the index keys of an index cursor and compares them with the expected keys
+ * The expected keys data contains the expected keys of 2 bytes each
+ * Returns 1 if the index keys match, 0 if not or -1 on error
+ */
+int esedb_test_index_cursor_compare_keys(
+     libesedb_index_cursor_t *index_cursor,
+     const uint8_t *expected_keys_data,
+     int number_of_expected_keys,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 2 ];
+
+	libesedb_index_key_t *index_key = NULL;
+	size_t key_data_size            = 0;
+	int key_index                   = 0;
+	int result                      = 0;
+
+	for( key_index = 0;
+	     key_index < number_of_expected_keys;
+	     key_index++ )
+	{
+		result = libesedb_index_cursor_get_next_key(
+		          index_cursor,
+		          &index_key,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		result = libesedb_index_key_get_data_size(
+		          index_key,
+		          &key_data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		if( key_data_size != 2 )
+		{
+			result = 0;
+
+			goto on_error;
+		}
+		result = libesedb_index_key_get_data(
+		          index_key,
+		          key_data,
+		          2,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		result = libesedb_index_key_free(
+		          &index_key,
+		          error );
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		if( memory_compare(
+		     key_data,
+		     &( expected_keys_data[ key_index * 2 ] ),
+		     2 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	/* No index keys are expected after the last expected key
+	 */
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          &index_key,
+	          error );
+
+	if( result != 0 )
+	{
+		if( result == 1 )
+		{
+			result = 0;
+		}
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libesedb_index_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_seek(
+     libesedb_index_t *index )
+{
+	uint8_t expected_keys_data[ 6 ] = {
+		0x02, 0x01, 0x02, 0x02, 0x02, 0x03 };
+
+	uint8_t key_data[ 2 ] = {
+		0x02, 0x02 };
+
+	uint8_t missing_key_data[ 2 ] = {
+		0x02, 0x04 };
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	int result                            = 0;
+
+	/* Test seek of a key that is equal
+	 */
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          &( expected_keys_data[ 2 ] ),
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek of a key that is equal where the key is not in the index
+	 */
+	result = libesedb_index_seek(
+	          index,
+	          missing_key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek of a key prefix, where the keys span both leaf pages
+	 */
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          1,
+	          LIBESEDB_SEEK_TYPE_PREFIX,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          expected_keys_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seek of a key that is greater than or equal
+	 */
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_GREATER_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_keys_data[ 0 ] = 0x02;
+	expected_keys_data[ 1 ] = 0x02;
+	expected_keys_data[ 2 ] = 0x02;
+	expected_keys_data[ 3 ] = 0x03;
+	expected_keys_data[ 4 ] = 0x03;
+	expected_keys_data[ 5 ] = 0x01;
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          expected_keys_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_seek(
+	          NULL,
+	          key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          index,
+	          NULL,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          0,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          2,
+	          0xff,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_cursor = (libesedb_index_cursor_t *) 0x12345678UL;
+
+	result = libesedb_index_seek(
+	          index,
+	          key_data,
+	          2,
+	          LIBESEDB_SEEK_TYPE_EQUAL,
+	          &index_cursor,
+	          &error );
+
+	index_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_range function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_range(
+     libesedb_index_t *index )
+{
+	uint8_t expected_keys_data[ 10 ] = {
+		0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01 };
+
+	uint8_t expected_backward_keys_data[ 10 ] = {
+		0x03, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01 };
+
+	uint8_t start_key_data[ 2 ] = {
+		0x02, 0x01 };
+
+	uint8_t stop_key_data[ 2 ] = {
+		0x02, 0x03 };
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	int result                            = 0;
+
+	/* Test range where the stop key is excluded
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          &( expected_keys_data[ 2 ] ),
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test range where the stop key is included
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          &( expected_keys_data[ 2 ] ),
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test range without start and stop key
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          expected_keys_data,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test backward range where the stop key is excluded
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          LIBESEDB_RANGE_FLAG_BACKWARD,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          &( expected_backward_keys_data[ 4 ] ),
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test backward range where the stop key is included
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY | LIBESEDB_RANGE_FLAG_BACKWARD,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          &( expected_backward_keys_data[ 2 ] ),
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test backward range without start and stop key
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          LIBESEDB_RANGE_FLAG_BACKWARD,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          expected_backward_keys_data,
+	          5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty range where the start key equals the excluded stop key
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          stop_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test empty backward range where the start key is greater than the stop key
+	 */
+	result = libesedb_index_get_range(
+	          index,
+	          stop_key_data,
+	          2,
+	          start_key_data,
+	          2,
+	          LIBESEDB_RANGE_FLAG_INCLUDE_STOP_KEY | LIBESEDB_RANGE_FLAG_BACKWARD,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_cursor_compare_keys(
+	          index_cursor,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_get_range(
+	          NULL,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          0,
+	          stop_key_data,
+	          2,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0xff,
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_cursor = (libesedb_index_cursor_t *) 0x12345678UL;
+
+	result = libesedb_index_get_range(
+	          index,
+	          start_key_data,
+	          2,
+	          stop_key_data,
+	          2,
+	          0,
+	          &index_cursor,
+	          &error );
+
+	index_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_bookmark_entry_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_bookmark_entry_compare(
+     void )
+{
+	uint8_t bookmark_entries_data[ 10 ] = {
+		0x7f, 0x80, 0x00, 0x03, 0x7f, 0x80, 0x00, 0x01, 0x7f, 0x80 };
+
+	libesedb_index_bookmark_entry_t bookmark_entries[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 * The bookmark keys of entries 0 and 2 are equal
+	 */
+	memory_set(
+	 bookmark_entries,
+	 0,
+	 sizeof( libesedb_index_bookmark_entry_t ) * 4 );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libesedb_page_tree_key_initialize(
+		          &( bookmark_entries[ entry_index ].bookmark_key ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		bookmark_entries[ entry_index ].entry_index = entry_index;
+	}
+	result = libesedb_page_tree_key_set_data(
+	          bookmark_entries[ 0 ].bookmark_key,
+	          &( bookmark_entries_data[ 0 ] ),
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_key_set_data(
+	          bookmark_entries[ 1 ].bookmark_key,
+	          &( bookmark_entries_data[ 4 ] ),
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_key_set_data(
+	          bookmark_entries[ 2 ].bookmark_key,
+	          &( bookmark_entries_data[ 0 ] ),
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_key_set_data(
+	          bookmark_entries[ 3 ].bookmark_key,
+	          &( bookmark_entries_data[ 8 ] ),
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 0 ] ),
+	          &( bookmark_entries[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 1 ] ),
+	          &( bookmark_entries[ 0 ] ) );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a shorter key that is a prefix of a longer key
+	 */
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 3 ] ),
+	          &( bookmark_entries[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test equal keys, which are ordered by index entry
+	 */
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 0 ] ),
+	          &( bookmark_entries[ 2 ] ) );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 2 ] ),
+	          &( bookmark_entries[ 0 ] ) );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_bookmark_entry_compare(
+	          &( bookmark_entries[ 2 ] ),
+	          &( bookmark_entries[ 2 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libesedb_page_tree_key_free(
+		          &( bookmark_entries[ entry_index ].bookmark_key ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		if( bookmark_entries[ entry_index ].bookmark_key != NULL )
+		{
+			libesedb_page_tree_key_free(
+			 &( bookmark_entries[ entry_index ].bookmark_key ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Compares the records with the expected bookmarks
+ * The last byte of the record data contains the bookmark
+ * Returns 1 if the records match or 0 if not
+ */
+int esedb_test_index_compare_records(
+     libesedb_record_t **records,
+     const uint8_t *expected_bookmarks,
+     int number_of_records )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	int record_index                            = 0;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		internal_record = (libesedb_internal_record_t *) records[ record_index ];
+
+		if( ( internal_record == NULL )
+		 || ( internal_record->data_definition == NULL )
+		 || ( internal_record->data_definition->record_data == NULL )
+		 || ( internal_record->data_definition->record_data_size != 5 ) )
+		{
+			return( 0 );
+		}
+		if( internal_record->data_definition->record_data[ 4 ] != expected_bookmarks[ record_index ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libesedb_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_records(
+     libesedb_index_t *index )
+{
+	libesedb_record_t *records[ 4 ] = {
+		NULL, NULL, NULL, NULL };
+
+	uint8_t expected_bookmarks[ 4 ] = {
+		3, 1, 3, 2 };
+
+	libcerror_error_t *error = NULL;
+	int record_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The records are returned in index entry order even though they are
+	 * retrieved in bookmark order
+	 */
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          4,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_compare_records(
+	          records,
+	          expected_bookmarks,
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Index entries with the same bookmark are retrieved as separate records
+	 */
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "records[ 2 ]",
+	 (intptr_t) records[ 2 ],
+	 (intptr_t) records[ 0 ] );
+
+	for( record_index = 0;
+	     record_index < 4;
+	     record_index++ )
+	{
+		result = libesedb_record_free(
+		          &( records[ record_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test retrieving records of which the bookmark of the last index entry is missing
+	 */
+	result = libesedb_index_get_records(
+	          index,
+	          2,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The records that were retrieved before the error are freed
+	 */
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "records[ record_index ]",
+		 records[ record_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_index_get_records(
+	          NULL,
+	          0,
+	          4,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          index,
+	          0,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( record_index = 0;
+	     record_index < 4;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_get_records(
+     libesedb_index_t *index )
+{
+	libesedb_record_t *records[ 3 ] = {
+		NULL, NULL, NULL };
+
+	uint8_t expected_bookmarks[ 3 ] = {
+		1, 3, 2 };
+
+	libcerror_error_t *error                  = NULL;
+	libesedb_internal_index_t *internal_index = NULL;
+	int record_index                          = 0;
+	int result                                = 0;
+
+	internal_index = (libesedb_internal_index_t *) index;
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          1,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_compare_records(
+	          records,
+	          expected_bookmarks,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		result = libesedb_record_free(
+		          &( records[ record_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_get_records(
+	          NULL,
+	          1,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          -1,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          1,
+	          0,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          INT_MAX,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          1,
+	          3,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records[ 1 ] = (libesedb_record_t *) 0x12345678UL;
+
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          1,
+	          3,
+	          records,
+	          &error );
+
+	records[ 1 ] = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving records beyond the last index entry
+	 */
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          3,
+	          3,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "records[ record_index ]",
+		 records[ record_index ] );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( record_index = 0;
+	     record_index < 3;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -89,6 +1911,24 @@ int main(
      char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	libesedb_memory_map_t memory_map;
+
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_index_t *index                                 = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_page_tree_t *table_page_tree                   = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	libfcache_cache_t *pages_cache                          = NULL;
+	libfdata_vector_t *pages_vector                         = NULL;
+	int segment_index                                       = 0;
+	int result                                              = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -114,15 +1954,498 @@ int main(
 
 	/* TODO: add tests for libesedb_index_get_utf16_name */
 
+	/* TODO: add tests for libesedb_index_get_number_of_key_columns */
+
 	/* TODO: add tests for libesedb_index_get_number_of_records */
 
 	/* TODO: add tests for libesedb_index_get_record */
 
+	/* TODO: add tests for libesedb_internal_index_get_bookmark_key */
+
+	/* TODO: add tests for libesedb_internal_index_get_record_by_bookmark_key */
+
+	/* TODO: add tests for libesedb_internal_index_get_record_by_data_definition */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_bookmark_entry_compare",
+	 esedb_test_index_bookmark_entry_compare );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize index for tests
+	 * The index and table pages are read from memory mapped file data
+	 */
+	memory_set(
+	 esedb_test_index_file_data,
+	 0,
+	 6 * 4096 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ 2 * 4096 ] ),
+	 esedb_test_index_page1_data,
+	 70 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ ( 3 * 4096 ) - 12 ] ),
+	 esedb_test_index_page1_tags,
+	 12 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ 3 * 4096 ] ),
+	 esedb_test_index_page2_data,
+	 67 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ ( 4 * 4096 ) - 16 ] ),
+	 esedb_test_index_page2_tags,
+	 16 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ 4 * 4096 ] ),
+	 esedb_test_index_page3_data,
+	 58 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ ( 5 * 4096 ) - 12 ] ),
+	 esedb_test_index_page3_tags,
+	 12 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ 5 * 4096 ] ),
+	 esedb_test_index_page4_data,
+	 89 );
+
+	memory_copy(
+	 &( esedb_test_index_file_data[ ( 6 * 4096 ) - 16 ] ),
+	 esedb_test_index_page4_tags,
+	 16 );
+
+	memory_map.data      = esedb_test_index_file_data;
+	memory_map.data_size = 6 * 4096;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version             = 0x620;
+	io_handle->format_revision            = 0x0c;
+	io_handle->page_size                  = 4096;
+	io_handle->memory_map                 = &memory_map;
+	io_handle->skip_checksum_verification = 1;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          6 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_vector",
+	 pages_vector );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->identifier              = 0x1e;
+	table_catalog_definition->father_data_page_number = 4;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition takes over management of the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_page_tree_initialize(
+	          &table_page_tree,
+	          io_handle,
+	          pages_vector,
+	          pages_cache,
+	          0x1e,
+	          4,
+	          table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_page_tree",
+	 table_page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_catalog_definition",
+	 index_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+	index_catalog_definition->identifier              = 0x1f;
+	index_catalog_definition->father_data_page_number = 1;
+
+	result = libesedb_index_initialize(
+	          &index,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          index_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          NULL,
+	          NULL,
+	          table_page_tree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Run tests
+	 */
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_index_seek",
+	 esedb_test_index_seek,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_index_get_range",
+	 esedb_test_index_get_range,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_index_get_records",
+	 esedb_test_index_get_records,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_index_get_records",
+	 esedb_test_internal_index_get_records,
+	 index );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_catalog_definition",
+	 index_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_free(
+	          &table_page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_page_tree",
+	 table_page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "pages_vector",
+	 pages_vector );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	/* TODO: add tests for libesedb_index_create_key */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
 on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( index_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &index_catalog_definition,
+		 NULL );
+	}
+	if( table_page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &table_page_tree,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 	return( EXIT_FAILURE );
 }
 
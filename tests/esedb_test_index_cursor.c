@@ -0,0 +1,2295 @@
+/*
+ * Library index_cursor type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_index_cursor.h"
+#include "../libesedb/libesedb_index_key.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_memory_map.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The index page tree consists of a root branch page (page 1) and 2 leaf pages
+ * Leaf page 2 contains the keys: 0x01 0x01, 0x02 0x01 and 0x02 0x02
+ * Leaf page 3 contains the keys: 0x02 0x03 and 0x03 0x01
+ * The keys 0x02 0x01, 0x02 0x02 and 0x02 0x03 are stored with a common key
+ */
+uint8_t esedb_test_index_cursor_page1_data[ 70 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xae, 0x0f, 0x00, 0x00,
+	0x1e, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_cursor_page1_tags[ 12 ] = {
+	0x06, 0x00, 0x18, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_cursor_page2_data[ 67 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xad, 0x0f, 0x00, 0x00,
+	0x1b, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x7f, 0x80, 0x00,
+	0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x7f, 0x80, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0x7f,
+	0x80, 0x00, 0x03 };
+
+uint8_t esedb_test_index_cursor_page2_tags[ 16 ] = {
+	0x09, 0x00, 0x12, 0x80, 0x09, 0x00, 0x09, 0x80, 0x08, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_index_cursor_page3_data[ 58 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xba, 0x0f, 0x00, 0x00,
+	0x12, 0x00, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x03, 0x7f, 0x80,
+	0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x7f, 0x80, 0x00, 0x05 };
+
+uint8_t esedb_test_index_cursor_page3_tags[ 12 ] = {
+	0x08, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00 };
+
+/* The file data consists of the 2 file header pages followed by the index pages
+ */
+uint8_t esedb_test_index_cursor_file_data[ 5 * 4096 ];
+
+/* Tests the libesedb_index_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_initialize(
+     void )
+{
+	uint8_t bound_key_data[ 4 ] = {
+		0x7f, 0x80, 0x00, 0x01 };
+
+	libesedb_internal_index_t internal_index;
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 2;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	/* Test index_cursor initialization
+	 */
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_initialize(
+	          NULL,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_cursor = (libesedb_index_cursor_t *) 0x12345678UL;
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	index_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          NULL,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          NULL,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          0,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          0xff,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_index_cursor_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_index_cursor_initialize(
+		          &index_cursor,
+		          &internal_index,
+		          bound_key_data,
+		          4,
+		          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+		          0,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( index_cursor != NULL )
+			{
+				libesedb_index_cursor_free(
+				 &index_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "index_cursor",
+			 index_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_index_cursor_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_index_cursor_initialize(
+		          &index_cursor,
+		          &internal_index,
+		          bound_key_data,
+		          4,
+		          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+		          0,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( index_cursor != NULL )
+			{
+				libesedb_index_cursor_free(
+				 &index_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "index_cursor",
+			 index_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the libesedb_index_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_index_cursor_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_get_next_record(
+     void )
+{
+	uint8_t bound_key_data[ 4 ] = {
+		0x7f, 0x80, 0x00, 0x01 };
+
+	libesedb_internal_index_t internal_index;
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	libesedb_record_t *record             = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an index without an IO handle
+	 */
+	result = libesedb_index_cursor_get_next_record(
+	          index_cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_get_next_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_get_next_key(
+     libesedb_index_t *index )
+{
+	uint8_t expected_keys_data[ 4 ] = {
+		0x02, 0x01, 0x02, 0x02 };
+
+	uint8_t start_key_data[ 2 ] = {
+		0x02, 0x01 };
+
+	uint8_t stop_key_data[ 2 ] = {
+		0x02, 0x03 };
+
+	uint8_t key_data[ 2 ];
+
+	libesedb_internal_index_t internal_index;
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	libesedb_index_key_t *index_key       = NULL;
+	int key_index                         = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          (libesedb_internal_index_t *) index,
+	          stop_key_data,
+	          2,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_EXCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_cursor_seek(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          start_key_data,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( key_index = 0;
+	     key_index < 2;
+	     key_index++ )
+	{
+		result = libesedb_index_cursor_get_next_key(
+		          index_cursor,
+		          &index_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "index_key",
+		 index_key );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_index_key_get_data(
+		          index_key,
+		          key_data,
+		          2,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          key_data,
+		          &( expected_keys_data[ key_index * 2 ] ),
+		          2 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libesedb_index_key_free(
+		          &index_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The stop key is excluded
+	 */
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no more index keys are available after the end of the range
+	 */
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_get_next_key(
+	          NULL,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_key = (libesedb_index_key_t *) 0x12345678UL;
+
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          &index_key,
+	          &error );
+
+	index_key = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an index without an IO handle
+	 */
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          NULL,
+	          0,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_get_next_key(
+	          index_cursor,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_cursor_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_cursor_seek(
+     libesedb_index_t *index )
+{
+	uint8_t key_data[ 2 ] = {
+		0x02, 0x02 };
+
+	uint8_t last_key_data[ 2 ] = {
+		0x04, 0x01 };
+
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libcerror_error_t *error                                = NULL;
+	libesedb_index_cursor_t *index_cursor                   = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          (libesedb_internal_index_t *) index,
+	          NULL,
+	          0,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	/* Test seek of a key that is equal to the last key of the first leaf page
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          key_data,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 3 );
+
+	/* Test seek of a key that is greater, which is the first key of the second leaf page
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          key_data,
+	          2,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 1 );
+
+	/* Test seek of a key that is greater than the keys in the index
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          last_key_data,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 3 );
+
+	/* Test seek of the first index entry
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 1 );
+
+	/* In backward order the index cursor is positioned at the index entry before the key
+	 */
+	internal_index_cursor->is_backward = 1;
+
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          key_data,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 2 );
+
+	/* Test seek of the last index entry in backward order
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_index_cursor->page_value_index",
+	 internal_index_cursor->page_value_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_cursor_seek(
+	          NULL,
+	          key_data,
+	          2,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_index_cursor->internal_index = NULL;
+
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          key_data,
+	          2,
+	          0,
+	          &error );
+
+	internal_index_cursor->internal_index = (libesedb_internal_index_t *) index;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_cursor_is_within_bound function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_cursor_is_within_bound(
+     void )
+{
+	uint8_t bound_key_data[ 4 ] = {
+		0x7f, 0x80, 0x00, 0x01 };
+
+	uint8_t key_data[ 6 ] = {
+		0x7f, 0x80, 0x00, 0x01, 0x00, 0x02 };
+
+	libesedb_internal_index_t internal_index;
+
+	libcerror_error_t *error              = NULL;
+	libesedb_index_cursor_t *index_cursor = NULL;
+	libesedb_page_tree_key_t *key         = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	result = libesedb_page_tree_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	/* Test with a key equal to the bound key
+	 */
+	result = libesedb_page_tree_key_set_data(
+	          key,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          &internal_index,
+	          bound_key_data,
+	          4,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_index_cursor_t *) index_cursor )->bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_EXCLUSIVE;
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a key greater than the bound key
+	 */
+	result = libesedb_page_tree_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	result = libesedb_page_tree_key_set_data(
+	          key,
+	          key_data,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_index_cursor_t *) index_cursor )->bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE;
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libesedb_internal_index_cursor_t *) index_cursor )->bound_type = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_PREFIX;
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* In backward order the bound key is the lower bound
+	 */
+	( (libesedb_internal_index_cursor_t *) index_cursor )->bound_type  = LIBESEDB_INDEX_CURSOR_BOUND_TYPE_INCLUSIVE;
+	( (libesedb_internal_index_cursor_t *) index_cursor )->is_backward = 1;
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a key less than the bound key
+	 */
+	result = libesedb_page_tree_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	result = libesedb_page_tree_key_set_data(
+	          key,
+	          key_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          NULL,
+	          key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_cursor_is_within_bound(
+	          (libesedb_internal_index_cursor_t *) index_cursor,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libesedb_internal_index_cursor_get_next_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_cursor_get_next_entry(
+     libesedb_index_t *index )
+{
+	uint8_t expected_keys_data[ 10 ] = {
+		0x03, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01 };
+
+	uint8_t key_data[ 2 ];
+
+	libesedb_internal_index_cursor_t *internal_index_cursor = NULL;
+	libcerror_error_t *error                                = NULL;
+	libesedb_index_cursor_t *index_cursor                   = NULL;
+	libesedb_index_key_t *index_key                         = NULL;
+	int key_index                                           = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_index_cursor_initialize(
+	          &index_cursor,
+	          (libesedb_internal_index_t *) index,
+	          NULL,
+	          0,
+	          LIBESEDB_INDEX_CURSOR_BOUND_TYPE_NONE,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_index_cursor = (libesedb_internal_index_cursor_t *) index_cursor;
+
+	result = libesedb_internal_index_cursor_seek(
+	          internal_index_cursor,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the index keys in backward order across the leaf pages
+	 */
+	for( key_index = 0;
+	     key_index < 5;
+	     key_index++ )
+	{
+		result = libesedb_internal_index_cursor_get_next_entry(
+		          internal_index_cursor,
+		          NULL,
+		          &index_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "index_key",
+		 index_key );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_index_key_get_data(
+		          index_key,
+		          key_data,
+		          2,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          key_data,
+		          &( expected_keys_data[ key_index * 2 ] ),
+		          2 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libesedb_index_key_free(
+		          &index_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          internal_index_cursor,
+	          NULL,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_index_cursor->leaf_page_number",
+	 internal_index_cursor->leaf_page_number,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          NULL,
+	          NULL,
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          internal_index_cursor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_index_cursor->internal_index = NULL;
+
+	result = libesedb_internal_index_cursor_get_next_entry(
+	          internal_index_cursor,
+	          NULL,
+	          &index_key,
+	          &error );
+
+	internal_index_cursor->internal_index = (libesedb_internal_index_t *) index;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_free(
+	          &index_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_cursor",
+	 index_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	if( index_cursor != NULL )
+	{
+		libesedb_index_cursor_free(
+		 &index_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	libesedb_memory_map_t memory_map;
+
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_index_t *index                                 = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	libfcache_cache_t *pages_cache                          = NULL;
+	libfdata_vector_t *pages_vector                         = NULL;
+	int segment_index                                       = 0;
+	int result                                              = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_initialize",
+	 esedb_test_index_cursor_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_free",
+	 esedb_test_index_cursor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_get_next_record",
+	 esedb_test_index_cursor_get_next_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_index_cursor_is_within_bound",
+	 esedb_test_internal_index_cursor_is_within_bound );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize index for tests
+	 * The index pages are read from memory mapped file data
+	 */
+	memory_set(
+	 esedb_test_index_cursor_file_data,
+	 0,
+	 5 * 4096 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ 2 * 4096 ] ),
+	 esedb_test_index_cursor_page1_data,
+	 70 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ ( 3 * 4096 ) - 12 ] ),
+	 esedb_test_index_cursor_page1_tags,
+	 12 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ 3 * 4096 ] ),
+	 esedb_test_index_cursor_page2_data,
+	 67 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ ( 4 * 4096 ) - 16 ] ),
+	 esedb_test_index_cursor_page2_tags,
+	 16 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ 4 * 4096 ] ),
+	 esedb_test_index_cursor_page3_data,
+	 58 );
+
+	memory_copy(
+	 &( esedb_test_index_cursor_file_data[ ( 5 * 4096 ) - 12 ] ),
+	 esedb_test_index_cursor_page3_tags,
+	 12 );
+
+	memory_map.data      = esedb_test_index_cursor_file_data;
+	memory_map.data_size = 5 * 4096;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version             = 0x620;
+	io_handle->format_revision            = 0x0c;
+	io_handle->page_size                  = 4096;
+	io_handle->memory_map                 = &memory_map;
+	io_handle->skip_checksum_verification = 1;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          5 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_vector",
+	 pages_vector );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table definition takes over management of the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_catalog_definition",
+	 index_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+	index_catalog_definition->identifier              = 0x1f;
+	index_catalog_definition->father_data_page_number = 1;
+
+	result = libesedb_index_initialize(
+	          &index,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          index_catalog_definition,
+	          pages_vector,
+	          pages_cache,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Run tests
+	 */
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_index_cursor_get_next_key",
+	 esedb_test_index_cursor_get_next_key,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_index_cursor_seek",
+	 esedb_test_internal_index_cursor_seek,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_index_cursor_get_next_entry",
+	 esedb_test_internal_index_cursor_get_next_entry,
+	 index );
+
+	/* Clean up
+	 */
+	result = libesedb_index_free(
+	          &index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &index_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_catalog_definition",
+	 index_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "pages_vector",
+	 pages_vector );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( index_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &index_catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2321 @@
+/*
+ * Library index_key type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_column_map.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_index_key.h"
+#include "../libesedb/libesedb_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_index_key_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_initialize(
+     void )
+{
+	uint8_t key_columns_data[ 4 ] = {
+		0x00, 0x00, 0x01, 0x00 };
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 256;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 4;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	/* Test index_key initialization
+	 */
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_initialize(
+	          NULL,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_key = (libesedb_index_key_t *) 0x12345678UL;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	index_key = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_index.io_handle = NULL;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_index.io_handle = &io_handle;
+
+	internal_index.index_catalog_definition = NULL;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_index.index_catalog_definition = &index_catalog_definition;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_index_key_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_index_key_initialize(
+		          &index_key,
+		          &internal_index,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( index_key != NULL )
+			{
+				libesedb_index_key_free(
+				 &index_key,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "index_key",
+			 index_key );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_index_key_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_index_key_initialize(
+		          &index_key,
+		          &internal_index,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( index_key != NULL )
+			{
+				libesedb_index_key_free(
+				 &index_key,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "index_key",
+			 index_key );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the libesedb_index_key_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_index_key_append_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_append_32bit(
+     void )
+{
+	uint8_t expected_data[ 10 ] = {
+		0x7f, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x7f, 0xff, 0xff, 0xfd };
+
+	/* The first key column is ascending, the second descending
+	 */
+	uint8_t key_columns_data[ 8 ] = {
+		0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00 };
+
+	uint8_t data[ 16 ];
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	size_t data_size                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 8;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_key_append_32bit(
+	          index_key,
+	          (uint32_t) -2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_append_32bit(
+	          index_key,
+	          0x80000002UL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data_size(
+	          index_key,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data(
+	          index_key,
+	          data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_append_32bit(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_index_key_append_32bit with all key columns set
+	 */
+	result = libesedb_index_key_append_32bit(
+	          index_key,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libesedb_index_key_append_32bit with a value that does not match the column type
+	 */
+	result = libesedb_index_key_append_16bit(
+	          index_key,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_key_get_value_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_get_value_32bit(
+     void )
+{
+	uint8_t key_data[ 10 ] = {
+		0x7f, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x7f, 0xff, 0xff, 0xfd };
+
+	/* The first key column is ascending, the second descending
+	 */
+	uint8_t key_columns_data[ 8 ] = {
+		0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00 };
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 8;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_key_set_data(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_key_get_value_32bit(
+	          index_key,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xfffffffeUL );
+
+	result = libesedb_index_key_get_value_32bit(
+	          index_key,
+	          1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x80000002UL );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_get_value_32bit(
+	          NULL,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_get_value_32bit(
+	          index_key,
+	          -1,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_get_value_32bit(
+	          index_key,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_get_value_32bit(
+	          index_key,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_index_key_get_value_32bit with a value that does not match the column type
+	 */
+	result = libesedb_index_key_get_value_16bit(
+	          index_key,
+	          0,
+	          (uint16_t *) &value_32bit,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_key_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_key_set_data(
+     void )
+{
+	uint8_t key_data[ 10 ] = {
+		0x7f, 0x7f, 0xff, 0xff, 0xfe, 0x80, 0x7f, 0xff, 0xff, 0xfd };
+
+	/* The first key column is ascending, the second descending
+	 */
+	uint8_t key_columns_data[ 8 ] = {
+		0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00 };
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 8;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_index_key_set_data(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_key_set_data(
+	          NULL,
+	          key_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_internal_index_key_set_data with data already set
+	 */
+	result = libesedb_internal_index_key_set_data(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_index_key_append_32bit with data already set
+	 */
+	result = libesedb_index_key_append_32bit(
+	          index_key,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libesedb_internal_index_key_set_data with data that exceeds the maximum key size
+	 */
+	index_catalog_definition.key_most = 4;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_key_set_data(
+	          (libesedb_internal_index_key_t *) index_key,
+	          key_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_key_set_data(
+	          NULL,
+	          key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_key_append_floating_point_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_append_floating_point_64bit(
+     void )
+{
+	uint8_t expected_data[ 18 ] = {
+		0x7f, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x7f, 0x40, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+	uint8_t key_columns_data[ 8 ] = {
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00 };
+
+	uint8_t data[ 32 ];
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	size_t data_size                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 8;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_key_append_floating_point_64bit(
+	          index_key,
+	          1.0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_append_floating_point_64bit(
+	          index_key,
+	          -1.0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data_size(
+	          index_key,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 18 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data(
+	          index_key,
+	          data,
+	          18,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          18 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_append_floating_point_64bit(
+	          NULL,
+	          0.0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_key_append_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_append_guid(
+     void )
+{
+	uint8_t expected_data[ 17 ] = {
+		0x7f, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x08, 0x09, 0x06, 0x07, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03 };
+
+	uint8_t guid_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t key_columns_data[ 4 ] = {
+		0x00, 0x00, 0x01, 0x00 };
+
+	uint8_t data[ 32 ];
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	size_t data_size                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_GUID;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_GUID;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 4;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_key_append_guid(
+	          index_key,
+	          guid_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data_size(
+	          index_key,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 17 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data(
+	          index_key,
+	          data,
+	          17,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          17 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_append_guid(
+	          NULL,
+	          guid_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_append_guid(
+	          index_key,
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_append_guid(
+	          index_key,
+	          guid_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_key_append_binary_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_key_append_binary_data(
+     void )
+{
+	uint8_t binary_data[ 10 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+
+	uint8_t expected_data[ 20 ] = {
+		0x7f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09,
+		0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40 };
+
+	uint8_t key_columns_data[ 8 ] = {
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01 };
+
+	uint8_t data[ 32 ];
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_catalog_definition_t index_catalog_definition;
+	libesedb_column_map_t column_map;
+	libesedb_internal_index_t internal_index;
+	libesedb_io_handle_t io_handle;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error          = NULL;
+	libesedb_index_key_t *index_key   = NULL;
+	size_t data_size                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libesedb_io_handle_t ) );
+
+	io_handle.ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 256;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA;
+	column_catalog_definitions[ 1 ].identifier  = 257;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	memory_set(
+	 &index_catalog_definition,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	index_catalog_definition.key_most              = 0;
+	index_catalog_definition.key_columns_data      = key_columns_data;
+	index_catalog_definition.key_columns_data_size = 8;
+
+	memory_set(
+	 &internal_index,
+	 0,
+	 sizeof( libesedb_internal_index_t ) );
+
+	internal_index.io_handle                = &io_handle;
+	internal_index.index_catalog_definition = &index_catalog_definition;
+	internal_index.column_map               = &column_map;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_key_append_binary_data(
+	          index_key,
+	          binary_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_append_binary_data(
+	          index_key,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data_size(
+	          index_key,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data(
+	          index_key,
+	          data,
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_key_is_truncated(
+	          index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libesedb_index_key_append_binary_data with a maximum key size
+	 */
+	index_catalog_definition.key_most = 12;
+
+	result = libesedb_index_key_initialize(
+	          &index_key,
+	          &internal_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_append_binary_data(
+	          index_key,
+	          binary_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data_size(
+	          index_key,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_key_get_data(
+	          index_key,
+	          data,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_index_key_is_truncated(
+	          index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_key_append_binary_data(
+	          NULL,
+	          binary_data,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_append_binary_data(
+	          index_key,
+	          NULL,
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_key_free(
+	          &index_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_key",
+	 index_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_key != NULL )
+	{
+		libesedb_index_key_free(
+		 &index_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_initialize",
+	 esedb_test_index_key_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_free",
+	 esedb_test_index_key_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_index_key_set_data",
+	 esedb_test_internal_index_key_set_data );
+
+	/* TODO: add tests for libesedb_internal_index_key_get_key_column */
+
+	/* TODO: add tests for libesedb_internal_index_key_append_segment_data */
+
+	/* TODO: add tests for libesedb_internal_index_key_append_fixed_size_value */
+
+	/* TODO: add tests for libesedb_index_key_get_data_size */
+
+	/* TODO: add tests for libesedb_index_key_get_data */
+
+	/* TODO: add tests for libesedb_index_key_is_truncated */
+
+	/* TODO: add tests for libesedb_index_key_append_null */
+
+	/* TODO: add tests for libesedb_index_key_append_boolean */
+
+	/* TODO: add tests for libesedb_index_key_append_8bit */
+
+	/* TODO: add tests for libesedb_index_key_append_16bit */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_append_32bit",
+	 esedb_test_index_key_append_32bit );
+
+	/* TODO: add tests for libesedb_index_key_append_64bit */
+
+	/* TODO: add tests for libesedb_index_key_append_filetime */
+
+	/* TODO: add tests for libesedb_index_key_append_floating_point_32bit */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_append_floating_point_64bit",
+	 esedb_test_index_key_append_floating_point_64bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_append_guid",
+	 esedb_test_index_key_append_guid );
+
+	/* TODO: add tests for libesedb_index_key_append_utf8_string */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_append_binary_data",
+	 esedb_test_index_key_append_binary_data );
+
+	/* TODO: add tests for libesedb_internal_index_key_get_segment */
+
+	/* TODO: add tests for libesedb_internal_index_key_get_fixed_size_value */
+
+	/* TODO: add tests for libesedb_index_key_get_column_identifier */
+
+	/* TODO: add tests for libesedb_index_key_get_value_boolean */
+
+	/* TODO: add tests for libesedb_index_key_get_value_8bit */
+
+	/* TODO: add tests for libesedb_index_key_get_value_16bit */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_key_get_value_32bit",
+	 esedb_test_index_key_get_value_32bit );
+
+	/* TODO: add tests for libesedb_index_key_get_value_64bit */
+
+	/* TODO: add tests for libesedb_index_key_get_value_filetime */
+
+	/* TODO: add tests for libesedb_index_key_get_value_floating_point_32bit */
+
+	/* TODO: add tests for libesedb_index_key_get_value_floating_point_64bit */
+
+	/* TODO: add tests for libesedb_index_key_get_value_guid */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
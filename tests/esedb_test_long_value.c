@@ -21,32 +21,678 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_segment.h"
+#include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_long_value.h"
 
+uint8_t esedb_test_long_value_data1[ 48 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f };
+
 /* Tests the libesedb_long_value_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_long_value_free(
-     void )
+int esedb_test_long_value_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_internal_long_value_get_data_segment_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_long_value_get_data_segment_at_offset(
+     libesedb_long_value_t *long_value )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_data_segment_t *data_segment = NULL;
+	off64_t data_segment_data_offset      = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_long_value_get_data_segment_at_offset(
+	          (libesedb_internal_long_value_t *) long_value,
+	          0,
+	          &data_segment_data_offset,
+	          &data_segment,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_segment",
+	 data_segment );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "data_segment_data_offset",
+	 (int64_t) data_segment_data_offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_segment->data_size",
+	 data_segment->data_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset in the second data segment
+	 */
+	data_segment = NULL;
+
+	result = libesedb_internal_long_value_get_data_segment_at_offset(
+	          (libesedb_internal_long_value_t *) long_value,
+	          20,
+	          &data_segment_data_offset,
+	          &data_segment,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_segment",
+	 data_segment );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "data_segment_data_offset",
+	 (int64_t) data_segment_data_offset,
+	 (int64_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_segment->data_size",
+	 data_segment->data_size,
+	 (size_t) 32 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "data_segment->data[ 4 ]",
+	 data_segment->data[ 4 ],
+	 (uint8_t) 0x14 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_long_value_get_data_segment_at_offset(
+	          NULL,
+	          0,
+	          &data_segment_data_offset,
+	          &data_segment,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_read_buffer(
+     libesedb_long_value_t *long_value )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test a read that crosses the boundary of the first data segment
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          8,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 8 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( esedb_test_long_value_data1[ 8 ] ),
+	          16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_long_value_get_offset(
+	          long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that is truncated at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              64,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 24 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( esedb_test_long_value_data1[ 24 ] ),
+	          24 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a zero-length read at the end of the data
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              0,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read beyond the end of the data
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          64,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 64 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libesedb_long_value_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              NULL,
+	              16,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libesedb_long_value_read_buffer(
+	              long_value,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_seek_offset(
+     libesedb_long_value_t *long_value )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 48 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -8,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 40 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -24,
+	          SEEK_CUR,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          4,
+	          SEEK_CUR,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seeking beyond the end of the data
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          16,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 64 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libesedb_long_value_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          -64,
+	          SEEK_END,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libesedb_long_value_seek_offset(
+	          long_value,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_long_value_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_offset(
+     libesedb_long_value_t *long_value )
 {
 	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
 	int result               = 0;
 
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_offset(
+	          long_value,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libesedb_long_value_free(
+	result = libesedb_long_value_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_long_value_get_offset(
+	          long_value,
 	          NULL,
 	          &error );
 
@@ -73,7 +719,66 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+/* Tests the libesedb_long_value_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_long_value_get_size(
+     libesedb_long_value_t *long_value )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_long_value_get_size(
+	          long_value,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 48 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_long_value_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -89,6 +794,19 @@ int main(
      char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                          = NULL;
+	libesedb_long_value_t *long_value                        = NULL;
+	libfdata_list_t *data_segments_list                      = NULL;
+	int element_index                                        = 0;
+	int result                                               = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -104,10 +822,253 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+	/* TODO: add tests for libesedb_internal_long_value_get_data_segment_by_index */
+
 	/* TODO: add tests for libesedb_long_value_get_data_size */
 
 	/* TODO: add tests for libesedb_long_value_get_data */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize long value for tests
+	 * The data is stored in 2 data segments of 16 and 32 bytes
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_long_value_data1,
+	          48,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_initialize(
+	          &data_segments_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_segments_list",
+	 data_segments_list );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          0,
+	          16,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_append_element(
+	          data_segments_list,
+	          &element_index,
+	          0,
+	          16,
+	          32,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_long_value_initialize(
+	          &long_value,
+	          file_io_handle,
+	          io_handle,
+	          column_catalog_definition,
+	          data_segments_list,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The long value takes over management of the data segments list
+	 */
+	data_segments_list = NULL;
+
+	/* Run tests
+	 */
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_long_value_get_data_segment_at_offset",
+	 esedb_test_internal_long_value_get_data_segment_at_offset,
+	 long_value );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_long_value_read_buffer",
+	 esedb_test_long_value_read_buffer,
+	 long_value );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_long_value_seek_offset",
+	 esedb_test_long_value_seek_offset,
+	 long_value );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_long_value_get_offset",
+	 esedb_test_long_value_get_offset,
+	 long_value );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_long_value_get_size",
+	 esedb_test_long_value_get_size,
+	 long_value );
+
+	/* Clean up
+	 */
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "long_value",
+	 long_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &column_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "column_catalog_definition",
+	 column_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	/* TODO: add tests for libesedb_long_value_get_record_value */
 
 	/* TODO: add tests for libesedb_long_value_get_number_of_data_segments */
@@ -129,6 +1090,44 @@ int main(
 	return( EXIT_SUCCESS );
 
 on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	if( data_segments_list != NULL )
+	{
+		libfdata_list_free(
+		 &data_segments_list,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( column_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &column_catalog_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,411 @@
+/*
+ * Library LZXPRESS decompression testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_lzxpress.h"
+
+/* The sequence: abcdefghijklmnopqrstuvwxyz compressed in LZXpress
+ */
+uint8_t esedb_test_lzxpress_compressed_data1[ 30 ] = {
+	0x3f, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+	0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a };
+
+/* The sequence: abc, followed by overlapping matches with distances 3, 1 and 4
+ * that use a 4-bit, a shared 4-bit and an 8-bit match size extension
+ */
+uint8_t esedb_test_lzxpress_compressed_data2[ 21 ] = {
+	0x00, 0x00, 0x00, 0x1a, 0x61, 0x62, 0x63, 0x17, 0x00, 0xff, 0x05, 0x07, 0x00, 0x00, 0x78, 0x1f,
+	0x00, 0x0f, 0xff, 0x29, 0x01 };
+
+/* A match at the start of the data, which refers to data before the uncompressed data
+ */
+uint8_t esedb_test_lzxpress_compressed_data3[ 6 ] = {
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00 };
+
+/* The sequence: a, followed by a match with a 32-bit match size extension of 0xfffffffd
+ */
+uint8_t esedb_test_lzxpress_compressed_data4[ 15 ] = {
+	0x00, 0x00, 0x00, 0x40, 0x61, 0x07, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_lzxpress_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_lzxpress_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz",
+	          26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data2,
+	          21,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 359 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          (uint8_t *) "abcabcabcabcabcabcabcabcabcabcabccccccccccccccccccccccccccx",
+	          59 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The last match repeats the sequence: cccx
+	 */
+	result = memory_compare(
+	          &( uncompressed_data[ 59 ] ),
+	          &( uncompressed_data[ 55 ] ),
+	          300 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          NULL,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          30,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          30,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = 16;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 64;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data2,
+	          21,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated compressed data
+	 */
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data1,
+	          3,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data2,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a match offset that is out of bounds
+	 */
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data3,
+	          6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a match size that would overflow
+	 */
+	uncompressed_data_size = 512;
+
+	result = libesedb_lzxpress_decompress(
+	          esedb_test_lzxpress_compressed_data4,
+	          15,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_lzxpress_decompress",
+	 esedb_test_lzxpress_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
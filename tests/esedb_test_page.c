@@ -533,6 +533,138 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_copy_mapped_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_copy_mapped_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_page_t *page    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->data           = esedb_test_page_data1;
+	page->data_size      = 4096;
+	page->data_is_mapped = 1;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_copy_mapped_data(
+	          page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page->data_is_mapped",
+	 (int) page->data_is_mapped,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->data",
+	 page->data );
+
+	result = ( page->data != esedb_test_page_data1 );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          page->data,
+	          esedb_test_page_data1,
+	          4096 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_copy_mapped_data(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		if( page->data_is_mapped != 0 )
+		{
+			page->data = NULL;
+		}
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_page_calculate_checksums function
  * Returns 1 if successful or 0 if not
  */
@@ -2048,10 +2180,16 @@ int main(
 	 "libesedb_page_free",
 	 esedb_test_page_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_copy_mapped_data",
+	 esedb_test_page_copy_mapped_data );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_page_calculate_checksums",
 	 esedb_test_page_calculate_checksums );
 
+	/* TODO: add tests for libesedb_page_verify_checksums */
+
 	ESEDB_TEST_RUN(
 	 "libesedb_page_read_tags",
 	 esedb_test_page_read_tags );
@@ -2060,10 +2198,14 @@ int main(
 	 "libesedb_page_read_values",
 	 esedb_test_page_read_values );
 
+	/* TODO: add tests for libesedb_page_read_data_file_io_handle */
+
 	ESEDB_TEST_RUN(
 	 "libesedb_page_read_file_io_handle",
 	 esedb_test_page_read_file_io_handle );
 
+	/* TODO: add tests for libesedb_page_get_from_pages_vector */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,10 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_data_definition.h"
 #include "../libesedb/libesedb_io_handle.h"
 #include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_root_page_header.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -416,6 +419,470 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_tree_compare_key_with_page_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_compare_key_with_page_value(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	int compare_result                          = 0;
+	int result                                  = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_compare_key_with_page_value(
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &page_tree_value,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_compare_key_with_page_value(
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          &page_value,
+	          NULL,
+	          &compare_result,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_compare_key_with_page_value(
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          &page_value,
+	          &page_tree_value,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_first_page_value_index_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_first_page_value_index_by_key(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint16_t page_value_index = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_get_first_page_value_index_by_key(
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "page_value_index",
+	 page_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_first_page_value_index_by_key(
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_number_of_owned_pages function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_number_of_owned_pages(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_page_tree_t *page_tree = NULL;
+	uint64_t number_of_owned_pages  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_get_number_of_owned_pages(
+	          page_tree,
+	          NULL,
+	          &number_of_owned_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_root_page_header_initialize(
+	          &( page_tree->root_page_header ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_tree->root_page_header->extent_space            = 0;
+	page_tree->root_page_header->initial_number_of_pages = 16;
+
+	result = libesedb_page_tree_get_number_of_owned_pages(
+	          page_tree,
+	          NULL,
+	          &number_of_owned_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_owned_pages",
+	 number_of_owned_pages,
+	 (uint64_t) 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_number_of_owned_pages(
+	          NULL,
+	          NULL,
+	          &number_of_owned_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_number_of_owned_pages(
+	          page_tree,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_read_leaf_value_from_leaf_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_read_leaf_value_from_leaf_page(
+     void )
+{
+	libesedb_data_definition_t data_definition;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &data_definition,
+	 0,
+	 sizeof( libesedb_data_definition_t ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_read_leaf_value_from_leaf_page(
+	          NULL,
+	          NULL,
+	          1,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_leaf_value_from_leaf_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_leaf_value_from_leaf_page(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	int result                                  = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_value_from_leaf_page(
+	          NULL,
+	          NULL,
+	          1,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -453,16 +920,58 @@ int main(
 
 	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values_from_page */
 
+	/* TODO: add tests for libesedb_page_tree_read_leaf_page_descriptors */
+
+	/* TODO: add tests for libesedb_page_tree_read_leaf_page_descriptors_from_sidecar */
+
+	/* TODO: add tests for libesedb_page_tree_append_leaf_page_descriptors_to_sidecar */
+
 	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values */
 
+	/* TODO: add tests for libesedb_page_tree_get_estimated_number_of_leaf_pages_from_page */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_number_of_owned_pages",
+	 esedb_test_page_tree_get_number_of_owned_pages );
+
+	/* TODO: add tests for libesedb_page_tree_get_estimated_number_of_leaf_values */
+
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index_from_page */
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_read_leaf_value_from_leaf_page",
+	 esedb_test_page_tree_read_leaf_value_from_leaf_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_value_from_leaf_page",
+	 esedb_test_page_tree_get_leaf_value_from_leaf_page );
+
+	/* TODO: add tests for libesedb_page_tree_get_leaf_page_descriptors_from_page */
+
+	/* TODO: add tests for libesedb_page_tree_get_leaf_page_descriptors */
+
+	/* TODO: add tests for libesedb_page_tree_get_key_of_page_value */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_compare_key_with_page_value",
+	 esedb_test_page_tree_compare_key_with_page_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_first_page_value_index_by_key",
+	 esedb_test_page_tree_get_first_page_value_index_by_key );
+
+	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key_from_page_value */
+
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key_from_page */
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key */
 
+	/* TODO: add tests for libesedb_page_tree_get_first_page_value_index_by_key_data */
+
+	/* TODO: add tests for libesedb_page_tree_get_leaf_page_value_index_by_key_data */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -104,6 +104,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+	/* TODO: add tests for libesedb_record_get_record_value_by_index */
+
+	/* TODO: add tests for libesedb_internal_record_get_uncompressed_value_data */
+
 	/* TODO: add tests for libesedb_record_get_number_of_values */
 
 	/* TODO: add tests for libesedb_record_get_column_catalog_definition */
@@ -120,6 +124,12 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_utf16_column_name */
 
+	/* TODO: add tests for libesedb_record_get_value_entry_by_column_identifier */
+
+	/* TODO: add tests for libesedb_record_get_value_entry_by_utf8_column_name */
+
+	/* TODO: add tests for libesedb_record_get_value_entry_by_utf16_column_name */
+
 	/* TODO: add tests for libesedb_record_get_value */
 
 	/* TODO: add tests for libesedb_record_get_value_data_size */
@@ -128,6 +138,8 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_value_data_flags */
 
+	/* TODO: add tests for libesedb_record_get_value_data_reference */
+
 	/* TODO: add tests for libesedb_record_get_value_boolean */
 
 	/* TODO: add tests for libesedb_record_get_value_8bit */
@@ -0,0 +1,808 @@
+/*
+ * Library record_cursor type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libfcache.h"
+#include "esedb_test_libfdata.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_memory_map.h"
+#include "../libesedb/libesedb_record_cursor.h"
+#include "../libesedb/libesedb_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* The leaf pages 2 and 3 do not contain records and reference each other
+ * as next page, hence the leaf page chain contains a cycle
+ * The leaf page 4 does not contain records and has no next page
+ */
+uint8_t esedb_test_record_cursor_page2_data[ 40 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_record_cursor_page3_data[ 40 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_record_cursor_page4_data[ 40 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+/* The file data consists of the 2 file header pages followed by the leaf pages
+ */
+uint8_t esedb_test_record_cursor_file_data[ 6 * 4096 ];
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_cursor_initialize(
+     void )
+{
+	libesedb_internal_table_t internal_table;
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_cursor_t *record_cursor = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_table,
+	 0,
+	 sizeof( libesedb_internal_table_t ) );
+
+	/* Test record_cursor initialization
+	 */
+	result = libesedb_record_cursor_initialize(
+	          &record_cursor,
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_cursor_free(
+	          &record_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_cursor_initialize(
+	          NULL,
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_cursor = (libesedb_record_cursor_t *) 0x12345678UL;
+
+	result = libesedb_record_cursor_initialize(
+	          &record_cursor,
+	          &internal_table,
+	          &error );
+
+	record_cursor = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_cursor_initialize(
+	          &record_cursor,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_cursor_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_record_cursor_initialize(
+		          &record_cursor,
+		          &internal_table,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( record_cursor != NULL )
+			{
+				libesedb_record_cursor_free(
+				 &record_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_cursor",
+			 record_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_cursor_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_record_cursor_initialize(
+		          &record_cursor,
+		          &internal_table,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( record_cursor != NULL )
+			{
+				libesedb_record_cursor_free(
+				 &record_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_cursor",
+			 record_cursor );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_cursor != NULL )
+	{
+		libesedb_record_cursor_free(
+		 &record_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the libesedb_record_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_cursor_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_cursor_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_cursor_get_next_record(
+     void )
+{
+	libesedb_internal_table_t internal_table;
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_cursor_t *record_cursor = NULL;
+	libesedb_record_t *record               = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_table,
+	 0,
+	 sizeof( libesedb_internal_table_t ) );
+
+	result = libesedb_record_cursor_initialize(
+	          &record_cursor,
+	          &internal_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_cursor_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a table without an IO handle
+	 */
+	result = libesedb_record_cursor_get_next_record(
+	          record_cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_cursor_free(
+	          &record_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_cursor != NULL )
+	{
+		libesedb_record_cursor_free(
+		 &record_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_record_cursor_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_record_cursor_get_next_record(
+     void )
+{
+	libesedb_internal_record_cursor_t internal_record_cursor;
+	libesedb_internal_table_t internal_table;
+	libesedb_memory_map_t memory_map;
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_record_t *record       = NULL;
+	libfcache_cache_t *pages_cache  = NULL;
+	libfdata_vector_t *pages_vector = NULL;
+	int result                      = 0;
+	int segment_index               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 esedb_test_record_cursor_file_data,
+	 0,
+	 6 * 4096 );
+
+	memory_copy(
+	 &( esedb_test_record_cursor_file_data[ 3 * 4096 ] ),
+	 esedb_test_record_cursor_page2_data,
+	 40 );
+
+	memory_copy(
+	 &( esedb_test_record_cursor_file_data[ 4 * 4096 ] ),
+	 esedb_test_record_cursor_page3_data,
+	 40 );
+
+	memory_copy(
+	 &( esedb_test_record_cursor_file_data[ 5 * 4096 ] ),
+	 esedb_test_record_cursor_page4_data,
+	 40 );
+
+	memory_map.data      = esedb_test_record_cursor_file_data;
+	memory_map.data_size = 6 * 4096;
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version             = 0x620;
+	io_handle->format_revision            = 0x0c;
+	io_handle->page_size                  = 4096;
+	io_handle->memory_map                 = &memory_map;
+	io_handle->skip_checksum_verification = 1;
+
+	result = libesedb_io_handle_set_pages_data_range(
+	          io_handle,
+	          6 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_initialize(
+	          &pages_vector,
+	          (size64_t) io_handle->page_size,
+	          (intptr_t *) io_handle,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_vector",
+	 pages_vector );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_append_segment(
+	          pages_vector,
+	          &segment_index,
+	          0,
+	          io_handle->pages_data_offset,
+	          io_handle->pages_data_size,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcache_cache_initialize(
+	          &pages_cache,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pages_cache",
+	 pages_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &internal_table,
+	 0,
+	 sizeof( libesedb_internal_table_t ) );
+
+	internal_table.io_handle    = io_handle;
+	internal_table.pages_vector = pages_vector;
+	internal_table.pages_cache  = pages_cache;
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_record_cursor_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a leaf page chain that contains a cycle
+	 */
+	memory_set(
+	 &internal_record_cursor,
+	 0,
+	 sizeof( libesedb_internal_record_cursor_t ) );
+
+	internal_record_cursor.internal_table       = &internal_table;
+	internal_record_cursor.leaf_page_number     = 2;
+	internal_record_cursor.page_value_index     = 1;
+	internal_record_cursor.number_of_leaf_pages = 1;
+	internal_record_cursor.is_initialized       = 1;
+
+	result = libesedb_internal_record_cursor_get_next_record(
+	          &internal_record_cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a leaf page chain that ends without a cycle
+	 */
+	internal_record_cursor.leaf_page_number     = 4;
+	internal_record_cursor.page_value_index     = 1;
+	internal_record_cursor.number_of_leaf_pages = 1;
+
+	result = libesedb_internal_record_cursor_get_next_record(
+	          &internal_record_cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &pages_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_vector_free(
+	          &pages_vector,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pages_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &pages_cache,
+		 NULL );
+	}
+	if( pages_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &pages_vector,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_cursor_initialize",
+	 esedb_test_record_cursor_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_cursor_free",
+	 esedb_test_record_cursor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_cursor_get_next_record",
+	 esedb_test_record_cursor_get_next_record );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_record_cursor_get_next_record",
+	 esedb_test_internal_record_cursor_get_next_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
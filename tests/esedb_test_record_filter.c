@@ -0,0 +1,983 @@
+/*
+ * Library record_filter type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_column_map.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_record_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_initialize(
+     void )
+{
+	libesedb_catalog_definition_t column_catalog_definitions[ 1 ];
+	libesedb_column_map_entry_t column_map_entries[ 1 ];
+
+	libesedb_column_map_t column_map;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 1;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_initialize(
+	          NULL,
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_filter = (libesedb_record_filter_t *) 0x12345678UL;
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &column_map,
+	          &error );
+
+	record_filter = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_filter_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_record_filter_initialize(
+		          &record_filter,
+		          &column_map,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libesedb_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_filter_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_record_filter_initialize(
+		          &record_filter,
+		          &column_map,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libesedb_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* Tests the libesedb_record_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_filter_append_integer_condition function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_append_integer_condition(
+     void )
+{
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_column_map_t column_map;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_append_integer_condition(
+	          record_filter,
+	          0,
+	          LIBESEDB_COMPARE_OPERATOR_GREATER_EQUAL,
+	          -5,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_conditions",
+	 ( (libesedb_internal_record_filter_t *) record_filter )->number_of_conditions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "last_column_entry",
+	 ( (libesedb_internal_record_filter_t *) record_filter )->last_column_entry,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_append_integer_condition(
+	          NULL,
+	          0,
+	          LIBESEDB_COMPARE_OPERATOR_EQUAL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_integer_condition(
+	          record_filter,
+	          2,
+	          LIBESEDB_COMPARE_OPERATOR_EQUAL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_filter_append_integer_condition(
+	          record_filter,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the column type does not support integer conditions
+	 */
+	result = libesedb_record_filter_append_integer_condition(
+	          record_filter,
+	          1,
+	          LIBESEDB_COMPARE_OPERATOR_EQUAL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_conditions",
+	 ( (libesedb_internal_record_filter_t *) record_filter )->number_of_conditions,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_filter_evaluate_expression function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_filter_evaluate_expression(
+     void )
+{
+	uint8_t filetime_data[ 8 ] = {
+		0x00, 0x80, 0x3e, 0xd5, 0xde, 0xb1, 0x9d, 0x01 };
+
+	uint8_t integer_data[ 4 ] = {
+		0x2a, 0x00, 0x00, 0x00 };
+
+	libesedb_catalog_definition_t column_catalog_definitions[ 2 ];
+	libesedb_column_map_entry_t column_map_entries[ 2 ];
+
+	libesedb_column_map_t column_map;
+
+	int identifier_buckets[ 1 ] = {
+		0 };
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_filter_t *record_filter = NULL;
+	uint64_t condition_results              = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 column_catalog_definitions,
+	 0,
+	 sizeof( libesedb_catalog_definition_t ) * 2 );
+
+	column_catalog_definitions[ 0 ].identifier  = 1;
+	column_catalog_definitions[ 0 ].column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+	column_catalog_definitions[ 1 ].identifier  = 2;
+	column_catalog_definitions[ 1 ].column_type = LIBESEDB_COLUMN_TYPE_DATE_TIME;
+
+	memory_set(
+	 column_map_entries,
+	 0,
+	 sizeof( libesedb_column_map_entry_t ) * 2 );
+
+	column_map_entries[ 0 ].column_catalog_definition   = &( column_catalog_definitions[ 0 ] );
+	column_map_entries[ 0 ].next_identifier_entry_index = 1;
+	column_map_entries[ 1 ].column_catalog_definition   = &( column_catalog_definitions[ 1 ] );
+	column_map_entries[ 1 ].next_identifier_entry_index = -1;
+
+	memory_set(
+	 &column_map,
+	 0,
+	 sizeof( libesedb_column_map_t ) );
+
+	column_map.entries            = column_map_entries;
+	column_map.number_of_entries  = 2;
+	column_map.identifier_buckets = identifier_buckets;
+	column_map.number_of_buckets  = 1;
+
+	result = libesedb_record_filter_initialize(
+	          &record_filter,
+	          &column_map,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty expression matches every record
+	 */
+	result = libesedb_record_filter_evaluate_expression(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The expression: column 0 >= 42 AND column 1 < 0x019db1ded53e8001
+	 */
+	result = libesedb_record_filter_append_integer_condition(
+	          record_filter,
+	          0,
+	          LIBESEDB_COMPARE_OPERATOR_GREATER_EQUAL,
+	          42,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_append_filetime_condition(
+	          record_filter,
+	          1,
+	          LIBESEDB_COMPARE_OPERATOR_LESS,
+	          0x019db1ded53e8001ULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_append_and(
+	          record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          0,
+	          integer_data,
+	          4,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          1,
+	          filetime_data,
+	          8,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "condition_results",
+	 condition_results,
+	 (uint64_t) 0x00000003UL );
+
+	result = libesedb_record_filter_evaluate_expression(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record where the second condition does not match is rejected
+	 */
+	condition_results = 0;
+
+	filetime_data[ 0 ] = 0x01;
+
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          0,
+	          integer_data,
+	          4,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          1,
+	          filetime_data,
+	          8,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "condition_results",
+	 condition_results,
+	 (uint64_t) 0x00000001UL );
+
+	result = libesedb_record_filter_evaluate_expression(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record without data for the first column is rejected
+	 */
+	condition_results = 0;
+
+	filetime_data[ 0 ] = 0x00;
+
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          0,
+	          NULL,
+	          0,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate_column(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          1,
+	          filetime_data,
+	          8,
+	          0,
+	          &condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_filter_evaluate_expression(
+	          (libesedb_internal_record_filter_t *) record_filter,
+	          condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_filter_evaluate_expression(
+	          NULL,
+	          condition_results,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libesedb_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_initialize",
+	 esedb_test_record_filter_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_free",
+	 esedb_test_record_filter_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	/* TODO: add tests for libesedb_record_filter_clone */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_append_integer_condition",
+	 esedb_test_record_filter_append_integer_condition );
+
+	/* TODO: add tests for libesedb_record_filter_append_filetime_condition */
+
+	/* TODO: add tests for libesedb_record_filter_append_binary_data_condition */
+
+	/* TODO: add tests for libesedb_record_filter_append_and */
+
+	/* TODO: add tests for libesedb_record_filter_append_or */
+
+	/* TODO: add tests for libesedb_record_filter_condition_matches_value */
+
+	/* TODO: add tests for libesedb_record_filter_evaluate_column */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_filter_evaluate_expression",
+	 esedb_test_record_filter_evaluate_expression );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
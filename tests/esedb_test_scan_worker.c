@@ -0,0 +1,622 @@
+/*
+ * Library scan_worker type testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_scan_worker.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Test callback function
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_scan_worker_callback_function(
+     libesedb_record_t *record ESEDB_TEST_ATTRIBUTE_UNUSED,
+     int worker_index ESEDB_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data ESEDB_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error ESEDB_TEST_ATTRIBUTE_UNUSED )
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( record )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( worker_index )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( callback_data )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Tests the libesedb_scan_worker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libesedb_scan_worker_t *scan_worker = NULL;
+	int result                          = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_initialize(
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_worker = (libesedb_scan_worker_t *) 0x12345678UL;
+
+	result = libesedb_scan_worker_initialize(
+	          &scan_worker,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	scan_worker = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_initialize(
+	          &scan_worker,
+	          -1,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_initialize(
+	          &scan_worker,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_worker != NULL )
+	{
+		libesedb_scan_worker_free(
+		 &scan_worker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_set_leaf_pages function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_set_leaf_pages(
+     void )
+{
+	libesedb_scan_worker_t scan_worker;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &scan_worker,
+	 0,
+	 sizeof( libesedb_scan_worker_t ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_set_leaf_pages(
+	          NULL,
+	          (libcdata_array_t *) 0x12345678UL,
+	          0,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_set_leaf_pages(
+	          &scan_worker,
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_set_leaf_pages(
+	          &scan_worker,
+	          (libcdata_array_t *) 0x12345678UL,
+	          -1,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_set_leaf_pages(
+	          &scan_worker,
+	          (libcdata_array_t *) 0x12345678UL,
+	          0,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_set_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_set_callback(
+     void )
+{
+	libesedb_scan_worker_t scan_worker;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &scan_worker,
+	 0,
+	 sizeof( libesedb_scan_worker_t ) );
+
+	/* Test regular cases
+	 */
+	result = libesedb_scan_worker_set_callback(
+	          &scan_worker,
+	          &esedb_test_scan_worker_callback_function,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_set_callback(
+	          NULL,
+	          &esedb_test_scan_worker_callback_function,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_set_callback(
+	          &scan_worker,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_scan_leaf_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_scan_leaf_page(
+     void )
+{
+	libesedb_scan_worker_t scan_worker;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &scan_worker,
+	 0,
+	 sizeof( libesedb_scan_worker_t ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_scan_leaf_page(
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_scan_leaf_page(
+	          &scan_worker,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_scan(
+     void )
+{
+	libesedb_scan_worker_t scan_worker;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &scan_worker,
+	 0,
+	 sizeof( libesedb_scan_worker_t ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_scan(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_scan_worker_scan(
+	          &scan_worker,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_scan_worker_run function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_scan_worker_run(
+     void )
+{
+	int result = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_scan_worker_run(
+	          NULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_initialize",
+	 esedb_test_scan_worker_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_free",
+	 esedb_test_scan_worker_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_set_leaf_pages",
+	 esedb_test_scan_worker_set_leaf_pages );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_set_callback",
+	 esedb_test_scan_worker_set_callback );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_scan_leaf_page",
+	 esedb_test_scan_worker_scan_leaf_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_scan",
+	 esedb_test_scan_worker_scan );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_scan_worker_run",
+	 esedb_test_scan_worker_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1019 @@
+/*
+ * Library sidecar type test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_sidecar.h"
+
+uint8_t esedb_test_sidecar_data1[ 80 ] = {
+	0x45, 0x53, 0x45, 0x44, 0x42, 0x53, 0x43, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x01, 0x00, 0x00, 0x00,
+	0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf3, 0xcd, 0xab, 0x89,
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_sidecar_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_sidecar_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_sidecar_t *sidecar     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_sidecar_initialize(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_free(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_sidecar_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sidecar = (libesedb_sidecar_t *) 0x12345678UL;
+
+	result = libesedb_sidecar_initialize(
+	          &sidecar,
+	          &error );
+
+	sidecar = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_sidecar_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_sidecar_initialize(
+		          &sidecar,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( sidecar != NULL )
+			{
+				libesedb_sidecar_free(
+				 &sidecar,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "sidecar",
+			 sidecar );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_sidecar_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_sidecar_initialize(
+		          &sidecar,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( sidecar != NULL )
+			{
+				libesedb_sidecar_free(
+				 &sidecar,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "sidecar",
+			 sidecar );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar != NULL )
+	{
+		libesedb_sidecar_free(
+		 &sidecar,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_sidecar_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_sidecar_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_sidecar_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_sidecar_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_sidecar_read_data(
+     void )
+{
+	uint8_t data[ 80 ];
+
+	libcerror_error_t *error    = NULL;
+	libesedb_sidecar_t *sidecar = NULL;
+	void *memcpy_result         = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	memcpy_result = memory_copy(
+	                 data,
+	                 esedb_test_sidecar_data1,
+	                 80 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libesedb_sidecar_initialize(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sidecar->page_size            = 8192;
+	sidecar->file_size            = 819200;
+	sidecar->file_header_checksum = 0x12345678UL;
+	sidecar->database_time        = 0x1234;
+
+	/* Test regular cases
+	 */
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          esedb_test_sidecar_data1,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "sidecar->number_of_sections",
+	 sidecar->number_of_sections,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar->sections_data_size",
+	 sidecar->sections_data_size,
+	 (size_t) 32 );
+
+	/* Test with data that is too small
+	 */
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          esedb_test_sidecar_data1,
+	          79,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid sections data checksum
+	 */
+	data[ 68 ] = 0x06;
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          data,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid signature
+	 */
+	data[ 68 ] = 0x05;
+	data[ 0 ]  = 0xff;
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          data,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a sidecar of another version of the database file
+	 */
+	sidecar->database_time = 0x1235;
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          esedb_test_sidecar_data1,
+	          80,
+	          &error );
+
+	sidecar->database_time = 0x1234;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_sidecar_read_data(
+	          NULL,
+	          esedb_test_sidecar_data1,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          NULL,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          esedb_test_sidecar_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_sidecar_free(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar != NULL )
+	{
+		libesedb_sidecar_free(
+		 &sidecar,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_sidecar_get_section function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_sidecar_get_section(
+     void )
+{
+	const uint8_t *entries_data = NULL;
+	const uint8_t *entry_data   = NULL;
+	libcerror_error_t *error    = NULL;
+	libesedb_sidecar_t *sidecar = NULL;
+	size_t entries_data_offset  = 0;
+	size_t entries_data_size    = 0;
+	size_t entry_data_size      = 0;
+	uint32_t number_of_entries  = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_sidecar_initialize(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sidecar->page_size            = 8192;
+	sidecar->file_size            = 819200;
+	sidecar->file_header_checksum = 0x12345678UL;
+	sidecar->database_time        = 0x1234;
+
+	result = libesedb_sidecar_read_data(
+	          sidecar,
+	          esedb_test_sidecar_data1,
+	          80,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_sidecar_get_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	          4,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "entries_data",
+	 entries_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "entries_data_size",
+	 entries_data_size,
+	 (size_t) 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_get_next_entry(
+	          entries_data,
+	          entries_data_size,
+	          &entries_data_offset,
+	          &entry_data,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "entry_data_size",
+	 entry_data_size,
+	 (size_t) 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_get_next_entry(
+	          entries_data,
+	          entries_data_size,
+	          &entries_data_offset,
+	          &entry_data,
+	          &entry_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_get_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+	          4,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_sidecar_get_section(
+	          NULL,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	          4,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_sidecar_get_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_LEAF_PAGE_DESCRIPTORS,
+	          4,
+	          NULL,
+	          &entries_data_size,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_sidecar_free(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar != NULL )
+	{
+		libesedb_sidecar_free(
+		 &sidecar,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_sidecar_append_section and libesedb_sidecar_append_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_sidecar_append_entry(
+     void )
+{
+	uint8_t entry_data[ 3 ]     = { 'a', 'b', 'c' };
+
+	const uint8_t *entries_data = NULL;
+	libcerror_error_t *error    = NULL;
+	libesedb_sidecar_t *sidecar = NULL;
+	size_t entries_data_size    = 0;
+	uint32_t number_of_entries  = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_sidecar_initialize(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_sidecar_append_entry(
+	          sidecar,
+	          entry_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_sidecar_append_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_append_entry(
+	          sidecar,
+	          entry_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_append_entry(
+	          sidecar,
+	          entry_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_get_section(
+	          sidecar,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+	          4,
+	          &entries_data,
+	          &entries_data_size,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "entries_data_size",
+	 entries_data_size,
+	 (size_t) 13 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_sidecar_append_section(
+	          NULL,
+	          LIBESEDB_SIDECAR_SECTION_TYPE_CATALOG_VALUES,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_sidecar_append_entry(
+	          NULL,
+	          entry_data,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_sidecar_append_entry(
+	          sidecar,
+	          NULL,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_sidecar_free(
+	          &sidecar,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sidecar",
+	 sidecar );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar != NULL )
+	{
+		libesedb_sidecar_free(
+		 &sidecar,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_sidecar_initialize",
+	 esedb_test_sidecar_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_sidecar_free",
+	 esedb_test_sidecar_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_sidecar_read_data",
+	 esedb_test_sidecar_read_data );
+
+	/* TODO: add tests for libesedb_sidecar_read_file_io_handle */
+
+	/* TODO: add tests for libesedb_sidecar_write_file_io_handle */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_sidecar_get_section",
+	 esedb_test_sidecar_get_section );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_sidecar_append_entry",
+	 esedb_test_sidecar_append_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -126,14 +126,34 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_column */
 
+	/* TODO: add tests for libesedb_table_get_column_entry_by_identifier */
+
+	/* TODO: add tests for libesedb_table_get_column_entry_by_utf8_name */
+
+	/* TODO: add tests for libesedb_table_get_column_entry_by_utf16_name */
+
 	/* TODO: add tests for libesedb_table_get_number_of_indexes */
 
 	/* TODO: add tests for libesedb_table_get_index */
 
 	/* TODO: add tests for libesedb_table_get_number_of_records */
 
+	/* TODO: add tests for libesedb_table_get_estimated_number_of_records */
+
 	/* TODO: add tests for libesedb_table_get_record */
 
+	/* TODO: add tests for libesedb_table_set_column_projection */
+
+	/* TODO: add tests for libesedb_table_create_record_filter */
+
+	/* TODO: add tests for libesedb_table_set_record_filter */
+
+	/* TODO: add tests for libesedb_table_scan_records */
+
+	/* TODO: add tests for libesedb_internal_table_get_fixed_size_column */
+
+	/* TODO: add tests for libesedb_table_read_column_batch */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
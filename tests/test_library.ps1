@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle long_value multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree_value table_definition"
+$LibraryTests = "catalog catalog_definition checksum column column_map column_projection column_type compression data_definition data_segment database error file_header index index_cursor index_key io_handle long_value lzxpress memory_map multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record record_cursor record_filter table root_page_header scan_worker sidecar space_tree_value table_definition"
 $LibraryTestsWithInput = "file support"
 
 $InputGlob = "*"
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle long_value multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree_value table_definition";
+LIBRARY_TESTS="catalog catalog_definition checksum column column_map column_projection column_type compression data_definition data_segment database error file_header index index_cursor index_key io_handle long_value lzxpress memory_map multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record record_cursor record_filter table root_page_header scan_worker sidecar space_tree_value table_definition";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 